@@ -21,12 +21,14 @@ public:
     void testIfNot();
     void testIfAndNot();
     void testNENot();
+    void testNumericCompare();
 
     CPPUNIT_TEST_SUITE(Language_Conditionals);
 
     CPPUNIT_TEST(testIfNot);
     CPPUNIT_TEST(testIfAndNot);
     CPPUNIT_TEST(testNENot);
+    CPPUNIT_TEST(testNumericCompare);
 
     CPPUNIT_TEST_SUITE_END();
 };
@@ -159,6 +161,30 @@ void Language_Conditionals::testNENot()
     }
 }
 
+void Language_Conditionals::testNumericCompare()
+{
+    // Integer, Long and Double operands mixed in both directions
+    MacroSnippet myMacro(u"Option Explicit\n"
+                         "\n"
+                         "Function doUnitTest() As Integer\n"
+                         "Dim i As Integer, n As Long, d As Double, nCount As Integer\n"
+                         "n = 100000\n"
+                         "d = 2.5\n"
+                         "For i = 1 To 10\n"
+                         "If i < d Then nCount = nCount + 1\n"
+                         "If n > i Then nCount = nCount + 1\n"
+                         "If i = 3 Then nCount = nCount + 1\n"
+                         "If d >= i Then nCount = nCount + 1\n"
+                         "If i <> n Then nCount = nCount + 1\n"
+                         "Next i\n"
+                         "doUnitTest = nCount\n"
+                         "End Function\n"_ustr);
+    myMacro.Compile();
+    CPPUNIT_ASSERT(!myMacro.HasError());
+    SbxVariableRef pNew = myMacro.Run();
+    CPPUNIT_ASSERT_EQUAL(static_cast<sal_Int16>(25), pNew->GetInteger());
+}
+
 CPPUNIT_TEST_SUITE_REGISTRATION(Language_Conditionals);
 
 } // namespace
@@ -1187,6 +1187,22 @@ bool SbxValue::Compare( SbxOperator eOp, const SbxValue& rOp ) const
     bool bVBAInterop =  SbiRuntime::isVBAEnabled();
 #endif
 
+    // Fast path for two plain numbers, like the loop counters and cell values
+    // of number crunching macros: they are compared on a SbxDOUBLE-Basis below
+    // anyway, and without a broadcaster there is nothing to be notified first
+    auto IsPlainNumber = [](const SbxValue& r)
+    {
+        if (r.aData.eType != SbxINTEGER && r.aData.eType != SbxLONG
+            && r.aData.eType != SbxDOUBLE)
+            return false;
+        if (!r.CanRead())
+            return false;
+        const SbxVariable* pVar = dynamic_cast<const SbxVariable*>(&r);
+        return !pVar || !pVar->IsBroadcaster();
+    };
+    if (IsPlainNumber(*this) && IsPlainNumber(rOp))
+        return CompareNormal(ImpGetDouble(&aData), ImpGetDouble(&rOp.aData), eOp);
+
     bool bRes = false;
     ErrCode eOld = GetError();
     if( eOld != ERRCODE_NONE )
@@ -0,0 +1,134 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+/*
+ * This file is part of the LibreOffice project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <cppunit/TestAssert.h>
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/plugin/TestPlugIn.h>
+
+#include <com/sun/star/drawing/Position3D.hpp>
+
+#include <algorithm>
+#include <vector>
+
+#include <CommonConverters.hxx>
+
+using css::drawing::Position3D;
+
+class CommonConvertersTest : public CppUnit::TestFixture
+{
+public:
+     CPPUNIT_TEST_SUITE(CommonConvertersTest);
+     CPPUNIT_TEST(testReduceToColumnExtremes);
+     CPPUNIT_TEST(testReduceToColumnExtremesSmallSeries);
+     CPPUNIT_TEST_SUITE_END();
+
+     void testReduceToColumnExtremes();
+     void testReduceToColumnExtremesSmallSeries();
+
+private:
+};
+
+namespace
+{
+// nPointsPerColumn points in each of the nColumns columns between 0 and nColumns, with
+// y values jumping up and down within each column
+std::vector<Position3D> createNoisySeries( sal_Int32 nColumns, sal_Int32 nPointsPerColumn )
+{
+    std::vector<Position3D> aPoly;
+    for( sal_Int32 nColumn = 0; nColumn < nColumns; ++nColumn )
+    {
+        for( sal_Int32 i = 0; i < nPointsPerColumn; ++i )
+        {
+            const double fY = ( ( i * 37 + nColumn * 11 ) % 101 ) - 50.0;
+            aPoly.emplace_back( nColumn + double(i) / nPointsPerColumn, fY, 0.0 );
+        }
+    }
+    return aPoly;
+}
+}
+
+void CommonConvertersTest::testReduceToColumnExtremes()
+{
+    constexpr sal_Int32 nColumns = 10;
+    constexpr sal_Int32 nPointsPerColumn = 50; // more than four times the column count
+    const std::vector<Position3D> aSeries( createNoisySeries( nColumns, nPointsPerColumn ) );
+    std::vector<std::vector<Position3D>> aPolyPoly{ aSeries };
+
+    chart::reduceToColumnExtremes( aPolyPoly, 0.0, nColumns, nColumns );
+
+    CPPUNIT_ASSERT_EQUAL( size_t(1), aPolyPoly.size() );
+    const std::vector<Position3D>& rReduced = aPolyPoly[0];
+    CPPUNIT_ASSERT( rReduced.size() <= size_t(4 * nColumns) );
+
+    // the remaining points keep their order
+    for( size_t i = 1; i < rReduced.size(); ++i )
+        CPPUNIT_ASSERT( rReduced[i-1].PositionX < rReduced[i].PositionX );
+
+    size_t nReduced = 0;
+    for( sal_Int32 nColumn = 0; nColumn < nColumns; ++nColumn )
+    {
+        const auto itBegin = aSeries.begin() + nColumn * nPointsPerColumn;
+        const auto itEnd = itBegin + nPointsPerColumn;
+        const Position3D& rFirst = *itBegin;
+        const Position3D& rLast = *(itEnd - 1);
+        double fMin = rFirst.PositionY, fMax = rFirst.PositionY;
+        for( auto it = itBegin; it != itEnd; ++it )
+        {
+            fMin = std::min( fMin, it->PositionY );
+            fMax = std::max( fMax, it->PositionY );
+        }
+
+        // all points of the column that survived, each of them from the original series
+        std::vector<Position3D> aKept;
+        for( ; nReduced < rReduced.size() && rReduced[nReduced].PositionX < nColumn + 1; ++nReduced )
+        {
+            CPPUNIT_ASSERT( std::find( itBegin, itEnd, rReduced[nReduced] ) != itEnd );
+            aKept.push_back( rReduced[nReduced] );
+        }
+        // fewer if the first or last point is an extreme, too
+        CPPUNIT_ASSERT( aKept.size() >= 2 && aKept.size() <= 4 );
+        CPPUNIT_ASSERT( rFirst == aKept.front() );
+        CPPUNIT_ASSERT( rLast == aKept.back() );
+        CPPUNIT_ASSERT( std::any_of( aKept.begin(), aKept.end(),
+                                     [fMin]( const Position3D& rPos ) { return rPos.PositionY == fMin; } ) );
+        CPPUNIT_ASSERT( std::any_of( aKept.begin(), aKept.end(),
+                                     [fMax]( const Position3D& rPos ) { return rPos.PositionY == fMax; } ) );
+    }
+    CPPUNIT_ASSERT_EQUAL( rReduced.size(), nReduced );
+}
+
+void CommonConvertersTest::testReduceToColumnExtremesSmallSeries()
+{
+    constexpr sal_Int32 nColumns = 10;
+    // at most four points per column on average, and a short series next to a long one
+    const std::vector<Position3D> aSmall( createNoisySeries( nColumns, 4 ) );
+    const std::vector<Position3D> aShort( createNoisySeries( 2, 5 ) );
+    std::vector<std::vector<Position3D>> aPolyPoly{ aSmall, aShort, createNoisySeries( nColumns, 50 ) };
+
+    chart::reduceToColumnExtremes( aPolyPoly, 0.0, nColumns, nColumns );
+
+    CPPUNIT_ASSERT_EQUAL( size_t(3), aPolyPoly.size() );
+    CPPUNIT_ASSERT( aSmall == aPolyPoly[0] );
+    CPPUNIT_ASSERT( aShort == aPolyPoly[1] );
+    CPPUNIT_ASSERT( aPolyPoly[2].size() <= size_t(4 * nColumns) );
+
+    // without a usable x range or resolution nothing is touched
+    std::vector<std::vector<Position3D>> aUnchanged{ createNoisySeries( nColumns, 50 ) };
+    const std::vector<std::vector<Position3D>> aOriginal( aUnchanged );
+    chart::reduceToColumnExtremes( aUnchanged, 1.0, 1.0, nColumns );
+    chart::reduceToColumnExtremes( aUnchanged, 0.0, nColumns, 0 );
+    CPPUNIT_ASSERT( aOriginal == aUnchanged );
+}
+
+CPPUNIT_TEST_SUITE_REGISTRATION(CommonConvertersTest);
+
+CPPUNIT_PLUGIN_IMPLEMENT();
+
+/* vim:set shiftwidth=4 softtabstop=4 expandtab: */
@@ -107,6 +107,16 @@ void addPolygon( std::vector<std::vector<css::drawing::Position3D>>& rRet
 void appendPoly( std::vector<std::vector<css::drawing::Position3D>>& rRet
                 , const std::vector<std::vector<css::drawing::Position3D>>& rAdd );
 
+/** Reduce each run of consecutive points within the same one of nColumnCount columns
+    between fMinX and fMaxX to its first, lowest, highest and last point, in their
+    original order.
+
+    A straight line through the remaining points covers the same pixels as one through
+    all of them. Only polygons with more than four points per column are changed.
+*/
+void reduceToColumnExtremes( std::vector<std::vector<css::drawing::Position3D>>& rPolyPoly
+                , double fMinX, double fMaxX, sal_Int32 nColumnCount );
+
 /** PolyPolygonBezierCoords -> PolyPolygonShape3D
 */
 
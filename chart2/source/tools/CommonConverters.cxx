@@ -29,6 +29,7 @@
 #include <basegfx/matrix/b3dhommatrix.hxx>
 #include <basegfx/polygon/b2dpolygontools.hxx>
 
+#include <algorithm>
 #include <cstddef>
 #include <limits>
 
@@ -297,6 +298,52 @@ void appendPoly( std::vector<std::vector<css::drawing::Position3D>>& rRet, const
     }
 }
 
+void reduceToColumnExtremes( std::vector<std::vector<css::drawing::Position3D>>& rPolyPoly
+                , double fMinX, double fMaxX, sal_Int32 nColumnCount )
+{
+    if( nColumnCount <= 0 || !(fMaxX > fMinX) )
+        return;
+
+    auto lcl_getColumn = [&]( const drawing::Position3D& rPos )
+    {
+        return static_cast<sal_Int32>( nColumnCount*(rPos.PositionX - fMinX)/(fMaxX-fMinX) );
+    };
+
+    for( std::vector<drawing::Position3D>& rPoly : rPolyPoly )
+    {
+        const std::size_t nPointCount = rPoly.size();
+        if( nPointCount <= o3tl::make_unsigned(4*nColumnCount) )
+            continue;
+
+        std::vector<drawing::Position3D> aReduced;
+        std::size_t nRunStart = 0;
+        while( nRunStart < nPointCount )
+        {
+            const sal_Int32 nColumn = lcl_getColumn( rPoly[nRunStart] );
+            std::size_t nMin = nRunStart;
+            std::size_t nMax = nRunStart;
+            std::size_t nRunEnd = nRunStart + 1;
+            for( ; nRunEnd < nPointCount && lcl_getColumn( rPoly[nRunEnd] ) == nColumn; ++nRunEnd )
+            {
+                if( rPoly[nRunEnd].PositionY < rPoly[nMin].PositionY )
+                    nMin = nRunEnd;
+                if( rPoly[nRunEnd].PositionY > rPoly[nMax].PositionY )
+                    nMax = nRunEnd;
+            }
+
+            const std::size_t aKeep[4] = { nRunStart, std::min( nMin, nMax ), std::max( nMin, nMax ), nRunEnd - 1 };
+            aReduced.push_back( rPoly[aKeep[0]] );
+            for( int i = 1; i < 4; ++i )
+            {
+                if( aKeep[i] != aKeep[i-1] )
+                    aReduced.push_back( rPoly[aKeep[i]] );
+            }
+            nRunStart = nRunEnd;
+        }
+        rPoly = std::move( aReduced );
+    }
+}
+
 drawing::PolyPolygonShape3D BezierToPoly(
     const drawing::PolyPolygonBezierCoords& rBezier )
 {
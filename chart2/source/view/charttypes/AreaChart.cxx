@@ -207,6 +207,20 @@ static void lcl_removeDuplicatePoints( std::vector<std::vector<css::drawing::Pos
     rPolyPoly = std::move(aTmp);
 }
 
+/** Reduce the points of each polygon to the extremes per column of the given x resolution
+    across the scaled x range of the coordinate system, see reduceToColumnExtremes().
+ */
+static void lcl_reduceToColumnExtremes( std::vector<std::vector<css::drawing::Position3D>>& rPolyPoly
+                                      , PlottingPositionHelper const & rPosHelper, sal_Int32 nXResolution )
+{
+    double fScaledMinX = rPosHelper.getLogicMinX();
+    double fScaledMaxX = rPosHelper.getLogicMaxX();
+    double fDummy = 0.0;
+    rPosHelper.doLogicScaling( &fScaledMinX, &fDummy, &fDummy );
+    rPosHelper.doLogicScaling( &fScaledMaxX, &fDummy, &fDummy );
+    reduceToColumnExtremes( rPolyPoly, fScaledMinX, fScaledMaxX, nXResolution );
+}
+
 bool AreaChart::create_stepped_line(
         std::vector<std::vector<css::drawing::Position3D>> aStartPoly,
         chart2::CurveStyle eCurveStyle,
@@ -496,6 +510,10 @@ void AreaChart::impl_createSeriesShapes()
                                               m_pPosHelper->maySkipPointsInRegressionCalculation());
 
                 pSeriesPoly = &pSeries->m_aPolyPolygonShape3D;
+                //better performance for big data
+                if( m_nDimension != 3 && m_eCurveStyle == CurveStyle_LINES )
+                    lcl_reduceToColumnExtremes( *pSeriesPoly, rPosHelper,
+                        m_aCoordinateSystemResolution.hasElements() ? m_aCoordinateSystemResolution[0] : 1000 );
                 if( m_bArea )
                 {
                     if (!impl_createArea(pSeries.get(), pSeriesPoly,
@@ -40,6 +40,9 @@
 #include <unotools/syslocale.hxx>
 #include <unotools/charclass.hxx>
 
+#include <cassert>
+#include <limits>
+
 using namespace ::comphelper;
 using namespace connectivity;
 using namespace connectivity::flat;
@@ -432,10 +435,15 @@ void OFlatTable::construct()
 
     sal_uInt64 const nSize = m_pFileStream->remainingSize();
 
-    // Buffersize is dependent on the file-size
-    m_pFileStream->SetBufferSize(nSize > 1000000 ? 32768 :
+    // Buffersize is dependent on the file-size; large files are mostly scanned
+    // sequentially (mail merge, forms over the whole table), so read them in the
+    // biggest chunks SvStream supports
+    constexpr sal_uInt16 nLargeFileBufferSize = std::numeric_limits<sal_uInt16>::max();
+    m_pFileStream->SetBufferSize(nSize > 10000000 ? nLargeFileBufferSize :
+                                nSize > 1000000 ? 32768 :
                                 nSize > 100000  ? 16384 :
                                 nSize > 10000   ? 4096  : 1024);
+    assert(m_pFileStream->GetBufferSize() != 0 && "flat file stream must stay buffered");
 
     fillColumns(aAppLocale);
 
@@ -622,7 +630,17 @@ bool OFlatTable::fetchRow(OValueRefRow& _rRow, const OSQLColumns & _rCols, bool
                 {
 
                     OUString aStrConverted;
-                    if ( DataType::INTEGER != nType )
+                    const bool bPlainNumber
+                        = (!cThousandDelimiter || aStr.indexOf(cThousandDelimiter) < 0)
+                          && (cDecimalDelimiter == '.'
+                              || (aStr.indexOf('.') < 0
+                                  && (!cDecimalDelimiter || aStr.indexOf(cDecimalDelimiter) < 0)));
+                    if (bPlainNumber)
+                    {
+                        // nothing to strip or replace, which is the common case
+                        aStrConverted = aStr;
+                    }
+                    else if ( DataType::INTEGER != nType )
                     {
                         OSL_ENSURE((cDecimalDelimiter && nType != DataType::INTEGER) ||
                                    (!cDecimalDelimiter && nType == DataType::INTEGER),
@@ -7962,6 +7962,23 @@ static void preLoadTypeDetection()
     }
 }
 
+/// Fill the complete filter and frame loader configuration, which type detection alone leaves
+/// unloaded: otherwise every forked child parses it again on its first load or saveAs.
+static void preLoadFilterConfiguration()
+{
+    static constexpr OUString aFactories[] = {
+        u"com.sun.star.document.FilterFactory"_ustr,
+        u"com.sun.star.frame.FrameLoaderFactory"_ustr,
+    };
+    for (const OUString& rFactory : aFactories)
+    {
+        uno::Reference<container::XNameAccess> xNames(
+            xFactory->createInstanceWithContext(rFactory, xContext), uno::UNO_QUERY);
+        if (xNames)
+            (void)xNames->getElementNames();
+    }
+}
+
 /// Used only by LibreOfficeKit when used by Online to pre-initialize
 static void preloadData()
 {
@@ -8169,6 +8186,9 @@ static void preloadData()
     // Preload typedetection
     preLoadTypeDetection();
 
+    std::cerr << "Preload filter configuration\n";
+    preLoadFilterConfiguration();
+
     // Set user profile's path back to the original one
     rtl::Bootstrap::set(u"UserInstallation"_ustr, sUserPath);
 
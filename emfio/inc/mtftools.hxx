@@ -824,7 +824,7 @@ namespace emfio
         void                UpdateClipRegion();
         void                AddFromGDIMetaFile(GDIMetaFile& rGDIMetaFile);
 
-        void                PassEMFPlus(void const * pBuffer, sal_uInt32 nLength);
+        void                PassEMFPlus(std::unique_ptr<sal_uInt8[]> pBuffer, sal_uInt32 nLength);
         void                PassEMFPlusHeaderInfo();
 
         Color               ReadColor();
@@ -61,6 +61,7 @@ namespace emfio
 
         Point           ReadPoint();                // reads and converts a point (first X then Y)
         Point           ReadYX();                   // reads and converts a point (first Y then X)
+        void            ReadPoints(Point* pPoints, sal_uInt16 nCount); // reads nCount points at once, as ReadPoint()
         tools::Rectangle       ReadRectangle();            // reads and converts a rectangle
         Size            ReadYXExt();
         void            GetPlaceableBound(tools::Rectangle& rSize, SvStream* pStrm);
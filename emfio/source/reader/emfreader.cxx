@@ -576,9 +576,9 @@ namespace emfio
 
         mbEMFPlus = true;
         sal_uInt64 const pos = mpInputStream->Tell();
-        auto buffer = std::make_unique<char[]>( length );
-        PassEMFPlus( buffer.get(), mpInputStream->ReadBytes(buffer.get(), length) );
-        buffer.reset();
+        auto buffer = std::make_unique<sal_uInt8[]>( length );
+        const std::size_t nRead = mpInputStream->ReadBytes(buffer.get(), length);
+        PassEMFPlus( std::move(buffer), nRead );
         mpInputStream->Seek( pos );
 
         bHaveDC = false;
@@ -685,20 +685,25 @@ namespace emfio
         }
 
         tools::Polygon aPolygon(nPoints);
-        for (sal_uInt32 i = nStartIndex ; i < nPoints && mpInputStream->good(); i++ )
+        if (!mpInputStream->good())
+            return aPolygon;
+
+        // read all coordinates at once instead of going through the stream per number
+        std::vector<T> aCoords(2 * (nPoints - nStartIndex));
+        const sal_uInt32 nPointsRead = mpInputStream->ReadNumbers(aCoords.data(), aCoords.size()) / 2;
+        for (sal_uInt32 i = 0; i < nPointsRead; i++)
         {
-            T nX, nY;
-            *mpInputStream >> nX >> nY;
+            const T nX = aCoords[2 * i];
+            const T nY = aCoords[2 * i + 1];
 
-            SAL_INFO("emfio", "\t\t\tPoint " << i << " of " << nPoints - 1 << ": " << nX << ", " << nY);
+            SAL_INFO("emfio", "\t\t\tPoint " << nStartIndex + i << " of " << nPoints - 1 << ": " << nX << ", " << nY);
 
-            if (!mpInputStream->good())
-            {
-                SAL_WARN("emfio", "short read on polygon, truncating");
-                aPolygon.SetSize(i);
-                break;
-            }
-            aPolygon[ i ] = Point( nX, nY );
+            aPolygon[ nStartIndex + i ] = Point( nX, nY );
+        }
+        if (nStartIndex + nPointsRead < nPoints)
+        {
+            SAL_WARN("emfio", "short read on polygon, truncating");
+            aPolygon.SetSize(nStartIndex + nPointsRead);
         }
 
         return aPolygon;
@@ -796,17 +801,17 @@ namespace emfio
         {
             // Get polygon points
             tools::PolyPolygon aPolyPoly(nPoly);
+            std::vector<T> aCoords;
             for (sal_uInt32 i = 0; i < nPoly && mpInputStream->good(); ++i)
             {
                 const sal_uInt16 nPointCount(aPoints[i]);
                 std::vector<Point> aPtAry(nPointCount);
-                for (sal_uInt16 j = 0; j < nPointCount && mpInputStream->good(); ++j)
-                {
-                    T nX(0), nY(0);
-                    *mpInputStream >> nX >> nY;
-                    aPtAry[j] = Point( nX, nY );
-                    ++nReadPoints;
-                }
+                // read all coordinates of the polygon at once
+                aCoords.resize(2 * nPointCount);
+                const sal_uInt32 nPointsRead = mpInputStream->ReadNumbers(aCoords.data(), aCoords.size()) / 2;
+                for (sal_uInt32 j = 0; j < nPointsRead; ++j)
+                    aPtAry[j] = Point( aCoords[2 * j], aCoords[2 * j + 1] );
+                nReadPoints += nPointsRead;
 
                 aPolyPoly.Insert(tools::Polygon(aPtAry.size(), aPtAry.data()));
             }
@@ -956,13 +961,13 @@ namespace emfio
                             .ReadInt32(ny32)
                             .ReadUInt32(nPointsCount);
 
-                        aPoints.reserve(std::min<size_t>(nPointsCount, mpInputStream->remainingSize() / (sizeof(sal_Int32) * 2)));
-                        for (sal_uInt32 i = 0; i < nPointsCount && mpInputStream->good(); i++)
-                        {
-                            sal_Int32 nX, nY;
-                            *mpInputStream >> nX >> nY;
-                            aPoints.emplace_back(nX, nY);
-                        }
+                        // read all coordinates at once; one point more than the stream can
+                        // provide if the count is too large, so that the short read is noticed
+                        std::vector<sal_Int32> aCoords(2 * std::min<size_t>(nPointsCount, mpInputStream->remainingSize() / (sizeof(sal_Int32) * 2) + 1));
+                        const size_t nPointsRead = mpInputStream->ReadNumbers(aCoords.data(), aCoords.size()) / 2;
+                        aPoints.reserve(nPointsRead);
+                        for (size_t i = 0; i < nPointsRead; i++)
+                            aPoints.emplace_back(aCoords[2 * i], aCoords[2 * i + 1]);
                         aPointTypes.reserve(std::min<size_t>(nPointsCount, mpInputStream->remainingSize()));
                         for (sal_uInt32 i = 0; i < nPointsCount && mpInputStream->good(); i++)
                         {
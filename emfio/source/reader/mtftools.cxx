@@ -2575,10 +2575,11 @@ namespace emfio
         mpGDIMetaFile->UseCanvas( true );
     }
 
-    void MtfTools::PassEMFPlus( void const * pBuffer, sal_uInt32 nLength )
+    void MtfTools::PassEMFPlus( std::unique_ptr<sal_uInt8[]> pBuffer, sal_uInt32 nLength )
     {
         EMFP_DEBUG(printf ("\t\t\tadd EMF_PLUS comment length %04x\n",(unsigned int) nLength));
-        mpGDIMetaFile->AddAction( new MetaCommentAction( "EMF_PLUS"_ostr, 0, static_cast<const sal_uInt8*>(pBuffer), nLength ) );
+        // EMF+ records make up most of such files, hand the buffer over instead of copying it
+        mpGDIMetaFile->AddAction( new MetaCommentAction( "EMF_PLUS"_ostr, 0, std::move(pBuffer), nLength ) );
     }
 }
 
@@ -23,6 +23,7 @@
 #include <cstdlib>
 #include <memory>
 #include <optional>
+#include <vector>
 #include <o3tl/safeint.hxx>
 #include <o3tl/sprintf.hxx>
 #include <o3tl/unit_conversion.hxx>
@@ -263,6 +264,16 @@ namespace emfio
         return Point( nX, nY );
     }
 
+    void WmfReader::ReadPoints(Point* pPoints, sal_uInt16 nCount)
+    {
+        // read all coordinates with a single stream call, on a short read the
+        // remaining points are left alone and the stream is no longer good()
+        std::vector<sal_Int16> aCoords(2 * nCount);
+        const std::size_t nPointsRead = mpInputStream->ReadNumbers(aCoords.data(), aCoords.size()) / 2;
+        for (std::size_t i = 0; i < nPointsRead; ++i)
+            pPoints[i] = Point(aCoords[2 * i], aCoords[2 * i + 1]);
+    }
+
     tools::Rectangle WmfReader::ReadRectangle()
     {
         Point aBR, aTL;
@@ -519,8 +530,7 @@ namespace emfio
                 else
                 {
                     tools::Polygon aPoly(nPoints);
-                    for (sal_uInt16 i(0); i < nPoints && mpInputStream->good(); ++i)
-                        aPoly[ i ] = ReadPoint();
+                    ReadPoints(aPoly.GetPointAry(), nPoints);
                     DrawPolygon(std::move(aPoly), false/*bRecordPath*/);
                 }
 
@@ -576,15 +586,9 @@ namespace emfio
                             break;
                         }
 
-                        std::unique_ptr<Point[]> xPolygonPoints(new Point[nPointCount]);
-                        Point* pPtAry = xPolygonPoints.get();
-
-                        for(sal_uInt16 b(0); b < nPointCount && mpInputStream->good(); ++b)
-                        {
-                            pPtAry[b] = ReadPoint();
-                        }
-
-                        aPolyPoly.Insert( tools::Polygon(nPointCount, pPtAry) );
+                        tools::Polygon aPoly(nPointCount);
+                        ReadPoints(aPoly.GetPointAry(), nPointCount);
+                        aPolyPoly.Insert( aPoly );
                     }
 
                     bRecordOk &= mpInputStream->good();
@@ -609,8 +613,7 @@ namespace emfio
                 else
                 {
                     tools::Polygon aPoly(nPoints);
-                    for (sal_uInt16 i(0); i < nPoints && mpInputStream->good(); ++i)
-                        aPoly[ i ] = ReadPoint();
+                    ReadPoints(aPoly.GetPointAry(), nPoints);
                     DrawPolyLine( std::move(aPoly) );
                 }
 
@@ -1819,9 +1822,11 @@ namespace emfio
                         }
                         else
                         {
-                            for(sal_uInt16 i = 0; i < nPoints; i++ )
+                            std::vector<Point> aPoints(nPoints);
+                            ReadPoints(aPoints.data(), nPoints);
+                            for (const Point& rPoint : aPoints)
                             {
-                                GetWinExtMax( ReadPoint(), aBound, eMapMode );
+                                GetWinExtMax( rPoint, aBound, eMapMode );
                                 bBoundsDetermined = true;
                             }
                         }
@@ -1880,9 +1885,11 @@ namespace emfio
                         }
                         else
                         {
-                            for (sal_uInt16 i = 0; i < nPoints; i++ )
+                            std::vector<Point> aPoints(nPoints);
+                            ReadPoints(aPoints.data(), nPoints);
+                            for (const Point& rPoint : aPoints)
                             {
-                                GetWinExtMax( ReadPoint(), aBound, eMapMode );
+                                GetWinExtMax( rPoint, aBound, eMapMode );
                                 bBoundsDetermined = true;
                             }
                         }
@@ -1912,9 +1919,11 @@ namespace emfio
                         }
                         else
                         {
-                            for (sal_uInt16 i = 0; i < nPoints; ++i)
+                            std::vector<Point> aPoints(nPoints);
+                            ReadPoints(aPoints.data(), nPoints);
+                            for (const Point& rPoint : aPoints)
                             {
-                                GetWinExtMax( ReadPoint(), aBound, eMapMode );
+                                GetWinExtMax( rPoint, aBound, eMapMode );
                                 bBoundsDetermined = true;
                             }
                         }
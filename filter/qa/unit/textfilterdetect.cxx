@@ -251,6 +251,27 @@ CPPUNIT_TEST_FIXTURE(TextFilterDetectTest, testTdf163295)
     CPPUNIT_ASSERT_EQUAL(u"generic_Text"_ustr, detection);
 }
 
+CPPUNIT_TEST_FIXTURE(TextFilterDetectTest, testTextWithContainerExtension)
+{
+    // Given plain text in a file claiming to be a Word document, i.e. neither a ZIP
+    // nor an OLE2 container: the OOXML and binary Word detectors are skipped
+    auto xDetection(comphelper::getProcessServiceFactory()
+                        ->createInstance(u"com.sun.star.document.TypeDetection"_ustr)
+                        .queryThrow<document::XTypeDetection>());
+    SvMemoryStream aMemory;
+    aMemory.WriteOString("This is just some plain text, not a document package.
+");
+    aMemory.Seek(0);
+    uno::Reference<io::XInputStream> xStream(new utl::OStreamWrapper(aMemory));
+
+    css::uno::Sequence mediaDescriptor{
+        comphelper::makePropertyValue(u"URL"_ustr, u"file:///tmp/plain.docx"_ustr),
+        comphelper::makePropertyValue(u"InputStream"_ustr, xStream)
+    };
+    OUString detection = xDetection->queryTypeByDescriptor(mediaDescriptor, true);
+    CPPUNIT_ASSERT_EQUAL(u"generic_Text"_ustr, detection);
+}
+
 CPPUNIT_TEST_FIXTURE(TextFilterDetectTest, testMarkdownDetect)
 {
     uno::Reference<document::XExtendedFilterDetection> xDetect(
@@ -43,6 +43,8 @@
 #include <comphelper/lok.hxx>
 #include <comphelper/sequence.hxx>
 #include <comphelper/scopeguard.hxx>
+#include <algorithm>
+#include <iterator>
 #include <utility>
 
 #define DEBUG_TYPE_DETECTION 0
@@ -364,6 +366,138 @@ public:
     }
 };
 
+/// Container formats recognized from the first bytes of a stream.
+enum ContainerSignature : sal_uInt8
+{
+    SIGNATURE_NONE = 0x00, ///< enough data, but none of the known containers
+    SIGNATURE_ZIP = 0x01,
+    SIGNATURE_OLE2 = 0x02,
+    SIGNATURE_UNKNOWN = 0xff ///< could not be checked, e.g. stream too short or not seekable
+};
+
+/**
+ * Types whose deep detection can only ever succeed on one of the listed
+ * containers. Asking their detect service about anything else is a waste
+ * of time, as it opens and parses a storage just to say no.
+ *
+ * Only add types here where this is strictly true: the list is used to
+ * skip the deep detection, so a wrong entry means a missed document.
+ * Note that encrypted OOXML documents are OLE2 compound files.
+ */
+struct TypeSignature
+{
+    std::u16string_view sType;
+    sal_uInt8 nContainers;
+};
+
+constexpr TypeSignature aTypeSignatures[] = {
+    // ODF and StarOffice XML packages
+    { u"writer8_template", SIGNATURE_ZIP },
+    { u"writer8", SIGNATURE_ZIP },
+    { u"calc8_template", SIGNATURE_ZIP },
+    { u"calc8", SIGNATURE_ZIP },
+    { u"impress8_template", SIGNATURE_ZIP },
+    { u"impress8", SIGNATURE_ZIP },
+    { u"draw8_template", SIGNATURE_ZIP },
+    { u"draw8", SIGNATURE_ZIP },
+    { u"chart8", SIGNATURE_ZIP },
+    { u"math8", SIGNATURE_ZIP },
+    { u"writerglobal8_template", SIGNATURE_ZIP },
+    { u"writerglobal8", SIGNATURE_ZIP },
+    { u"writerweb8_writer_template", SIGNATURE_ZIP },
+    { u"StarBase", SIGNATURE_ZIP },
+    { u"calc_StarOffice_XML_Calc", SIGNATURE_ZIP },
+    { u"calc_StarOffice_XML_Calc_Template", SIGNATURE_ZIP },
+    { u"chart_StarOffice_XML_Chart", SIGNATURE_ZIP },
+    { u"draw_StarOffice_XML_Draw", SIGNATURE_ZIP },
+    { u"draw_StarOffice_XML_Draw_Template", SIGNATURE_ZIP },
+    { u"impress_StarOffice_XML_Impress", SIGNATURE_ZIP },
+    { u"impress_StarOffice_XML_Impress_Template", SIGNATURE_ZIP },
+    { u"math_StarOffice_XML_Math", SIGNATURE_ZIP },
+    { u"writer_StarOffice_XML_Writer", SIGNATURE_ZIP },
+    { u"writer_StarOffice_XML_Writer_Template", SIGNATURE_ZIP },
+    { u"writer_globaldocument_StarOffice_XML_Writer_GlobalDocument", SIGNATURE_ZIP },
+    { u"writer_web_StarOffice_XML_Writer_Web_Template", SIGNATURE_ZIP },
+
+    // OOXML, plain or encrypted
+    { u"writer_OOXML_Text_Template", SIGNATURE_ZIP | SIGNATURE_OLE2 },
+    { u"writer_OOXML", SIGNATURE_ZIP | SIGNATURE_OLE2 },
+    { u"writer_MS_Word_2007_Template", SIGNATURE_ZIP | SIGNATURE_OLE2 },
+    { u"writer_MS_Word_2007", SIGNATURE_ZIP | SIGNATURE_OLE2 },
+    { u"Office Open XML Spreadsheet Template", SIGNATURE_ZIP | SIGNATURE_OLE2 },
+    { u"Office Open XML Spreadsheet", SIGNATURE_ZIP | SIGNATURE_OLE2 },
+    { u"MS Excel 2007 XML Template", SIGNATURE_ZIP | SIGNATURE_OLE2 },
+    { u"MS Excel 2007 XML", SIGNATURE_ZIP | SIGNATURE_OLE2 },
+    { u"MS PowerPoint 2007 XML Template", SIGNATURE_ZIP | SIGNATURE_OLE2 },
+    { u"MS PowerPoint 2007 XML AutoPlay", SIGNATURE_ZIP | SIGNATURE_OLE2 },
+    { u"MS PowerPoint 2007 XML", SIGNATURE_ZIP | SIGNATURE_OLE2 },
+
+    // OLE2 compound documents
+    { u"writer_MS_Word_97_Vorlage", SIGNATURE_OLE2 },
+    { u"writer_MS_Word_97", SIGNATURE_OLE2 },
+    { u"calc_MS_Excel_97_VorlageTemplate", SIGNATURE_OLE2 },
+    { u"calc_MS_Excel_97", SIGNATURE_OLE2 },
+    { u"impress_MS_PowerPoint_97_Vorlage", SIGNATURE_OLE2 },
+    { u"impress_MS_PowerPoint_97_AutoPlay", SIGNATURE_OLE2 },
+    { u"impress_MS_PowerPoint_97", SIGNATURE_OLE2 },
+};
+
+const TypeSignature* findTypeSignature(std::u16string_view rType)
+{
+    for (const TypeSignature& rSignature : aTypeSignatures)
+    {
+        if (rSignature.sType == rType)
+            return &rSignature;
+    }
+    return nullptr;
+}
+
+/**
+ * Look at the first bytes of the stream to find out which kind of container
+ * it is. The stream position is left untouched.
+ */
+sal_uInt8 getContainerSignature(const css::uno::Reference<css::io::XInputStream>& xStream)
+{
+    static constexpr sal_uInt8 aOLE2Magic[]
+        = { 0xD0, 0xCF, 0x11, 0xE0, 0xA1, 0xB1, 0x1A, 0xE1 };
+
+    try
+    {
+        css::uno::Reference<css::io::XSeekable> xSeek(xStream, css::uno::UNO_QUERY);
+        if (!xSeek.is())
+            return SIGNATURE_UNKNOWN;
+
+        comphelper::ScopeGuard restorePos(
+            [xSeek, nPos = xSeek->getPosition()]
+            {
+                try
+                {
+                    xSeek->seek(nPos);
+                }
+                catch (const css::uno::Exception&)
+                {
+                }
+            });
+        xSeek->seek(0);
+
+        css::uno::Sequence<sal_Int8> aHeader;
+        // Empty and tiny files are left to the detectors, some of them accept these on purpose
+        if (xStream->readBytes(aHeader, std::size(aOLE2Magic)) < sal_Int32(std::size(aOLE2Magic)))
+            return SIGNATURE_UNKNOWN;
+
+        const sal_uInt8* pHeader = reinterpret_cast<const sal_uInt8*>(aHeader.getConstArray());
+        if (pHeader[0] == 'P' && pHeader[1] == 'K')
+            return SIGNATURE_ZIP;
+        if (std::equal(std::begin(aOLE2Magic), std::end(aOLE2Magic), pHeader))
+            return SIGNATURE_OLE2;
+        return SIGNATURE_NONE;
+    }
+    catch (const css::uno::Exception&)
+    {
+        return SIGNATURE_UNKNOWN;
+    }
+}
+
 #if DEBUG_TYPE_DETECTION
 void printFlatDetectionList(const char* caption, const FlatDetection& types)
 {
@@ -1000,6 +1134,10 @@ OUString TypeDetection::impl_detectTypeFlatAndDeep(      utl::MediaDescriptor& r
     //    or any needed information could not be
     //    obtained from the cache                 => ignore it, and continue with search
 
+    // the container kind of the stream, checked once on the first candidate which needs it
+    sal_uInt8 nSignature = SIGNATURE_UNKNOWN;
+    bool bSignatureChecked = false;
+
     for (auto const& flatTypeInfo : lFlatTypes)
     {
         if (m_bCancel)
@@ -1018,6 +1156,27 @@ OUString TypeDetection::impl_detectTypeFlatAndDeep(      utl::MediaDescriptor& r
             return sFlatType;
         }
 
+        // Skip the deep detection of types which can't match the container at all.
+        // All of them have a detect service, so the stream would be opened right
+        // below anyway.
+        if (const TypeSignature* pSignature = findTypeSignature(sFlatType))
+        {
+            if (!bSignatureChecked)
+            {
+                impl_openStream(rDescriptor);
+                nSignature = getContainerSignature(rDescriptor.getUnpackedValueOrDefault(
+                    utl::MediaDescriptor::PROP_INPUTSTREAM,
+                    css::uno::Reference<css::io::XInputStream>()));
+                bSignatureChecked = true;
+            }
+
+            if (nSignature != SIGNATURE_UNKNOWN && !(pSignature->nContainers & nSignature))
+            {
+                SAL_INFO("filter.config", "skip deep detection of " << sFlatType);
+                continue;
+            }
+        }
+
         try
         {
             // SAFE -> ----------------------------------
@@ -74,14 +74,17 @@ inline constexpr OUString UICOMMANDDESCRIPTION_NAMEACCESS_COMMANDMIRRORIMAGELIST
 inline constexpr OUString AUTORECOVERY_PROPNAME_ASCII_EXISTS_RECOVERYDATA = u"ExistsRecoveryData"_ustr;
 inline constexpr OUString AUTORECOVERY_PROPNAME_ASCII_EXISTS_SESSIONDATA = u"ExistsSessionData"_ustr;
 inline constexpr OUString AUTORECOVERY_PROPNAME_ASCII_CRASHED = u"Crashed"_ustr;
+inline constexpr OUString AUTORECOVERY_PROPNAME_ASCII_AUTOSAVE_FREEZEHISTOGRAM = u"AutoSaveFreezeHistogram"_ustr;
 
 #define AUTORECOVERY_PROPNAME_EXISTS_RECOVERYDATA       AUTORECOVERY_PROPNAME_ASCII_EXISTS_RECOVERYDATA
 #define AUTORECOVERY_PROPNAME_EXISTS_SESSIONDATA        AUTORECOVERY_PROPNAME_ASCII_EXISTS_SESSIONDATA
 #define AUTORECOVERY_PROPNAME_CRASHED                   AUTORECOVERY_PROPNAME_ASCII_CRASHED
+#define AUTORECOVERY_PROPNAME_AUTOSAVE_FREEZEHISTOGRAM  AUTORECOVERY_PROPNAME_ASCII_AUTOSAVE_FREEZEHISTOGRAM
 
 #define AUTORECOVERY_PROPHANDLE_EXISTS_RECOVERYDATA     0
 #define AUTORECOVERY_PROPHANDLE_EXISTS_SESSIONDATA      1
 #define AUTORECOVERY_PROPHANDLE_CRASHED                 2
+#define AUTORECOVERY_PROPHANDLE_AUTOSAVE_FREEZEHISTOGRAM 3
 
 /** properties for Filter config */
 
@@ -9,9 +9,11 @@
 
 #include <test/unoapi_test.hxx>
 
+#include <com/sun/star/beans/XPropertySet.hpp>
 #include <com/sun/star/frame/XFrame.hpp>
 #include <com/sun/star/frame/XComponentLoader.hpp>
 #include <com/sun/star/frame/FrameSearchFlag.hpp>
+#include <com/sun/star/frame/theAutoRecovery.hpp>
 #include <com/sun/star/util/URLTransformer.hpp>
 
 #include <comphelper/propertyvalue.hxx>
@@ -132,6 +134,19 @@ CPPUNIT_TEST_FIXTURE(Test, testURLTransformer_parseSmart)
     CPPUNIT_ASSERT_EQUAL(u"q=baz"_ustr, aURL.Arguments);
     CPPUNIT_ASSERT_EQUAL(u"F"_ustr, aURL.Mark);
 }
+
+CPPUNIT_TEST_FIXTURE(Test, testAutoRecoveryFreezeHistogram)
+{
+    // AutoSave reports how long it blocked the main thread, in buckets up to 50, 100, 250, 500,
+    // 1000, 2500, 5000 ms and above.
+    uno::Reference<beans::XPropertySet> xAutoRecovery(frame::theAutoRecovery::get(m_xContext),
+                                                      uno::UNO_QUERY_THROW);
+    uno::Sequence<sal_Int32> aHistogram;
+    CPPUNIT_ASSERT(xAutoRecovery->getPropertyValue(u"AutoSaveFreezeHistogram"_ustr) >>= aHistogram);
+    CPPUNIT_ASSERT_EQUAL(sal_Int32(8), aHistogram.getLength());
+    for (sal_Int32 nCount : aHistogram)
+        CPPUNIT_ASSERT_GREATEREQUAL(sal_Int32(0), nCount);
+}
 }
 
 CPPUNIT_PLUGIN_IMPLEMENT();
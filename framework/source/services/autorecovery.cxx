@@ -61,6 +61,8 @@
 #include <com/sun/star/lang/XServiceInfo.hpp>
 #include <com/sun/star/lang/XSingleServiceFactory.hpp>
 #include <com/sun/star/frame/XDispatch.hpp>
+#include <com/sun/star/io/NotConnectedException.hpp>
+#include <com/sun/star/io/XOutputStream.hpp>
 #include <com/sun/star/document/XDocumentEventListener.hpp>
 #include <com/sun/star/document/XDocumentEventBroadcaster.hpp>
 #include <com/sun/star/util/XChangesListener.hpp>
@@ -73,6 +75,7 @@
 #include <cppuhelper/compbase.hxx>
 #include <cppuhelper/propshlp.hxx>
 #include <cppuhelper/supportsservice.hxx>
+#include <cppuhelper/weakref.hxx>
 #include <o3tl/safeint.hxx>
 #include <o3tl/typed_flags_set.hxx>
 #include <o3tl/string_view.hxx>
@@ -81,6 +84,8 @@
 #include <comphelper/multiinterfacecontainer3.hxx>
 #include <comphelper/namedvaluecollection.hxx>
 #include <comphelper/sequence.hxx>
+#include <comphelper/seqstream.hxx>
+#include <comphelper/threadpool.hxx>
 #include <utility>
 #include <vcl/evntpost.hxx>
 #include <vcl/svapp.hxx>
@@ -103,6 +108,12 @@
 #include <officecfg/Office/Recovery.hxx>
 #include <officecfg/Setup.hxx>
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <memory>
+
 using namespace css::uno;
 using namespace css::document;
 using namespace css::frame;
@@ -268,6 +279,81 @@ template<> struct o3tl::typed_flags<Job>: o3tl::is_typed_flags<Job, 0xFFF> {};
 
 namespace {
 
+/** @short  a recovery file, which was exported into memory on the main thread
+            and is written to disc by a worker thread.
+
+    @descr  Exporting is the only step, which needs the document. As soon as its
+            result lives in Data the user can go on working, while writing and
+            syncing the file happens on the thread pool. Only after the file was
+            written completely it replaces the previous recovery file inside the
+            RecoveryList (see AutoRecovery::implts_finishBackgroundSaves()), so
+            a crash in between still finds the previous one.
+ */
+struct BackgroundSave
+{
+    /// weak, so the worker thread never releases the last reference to the document
+    css::uno::WeakReference< css::frame::XModel > Document;
+    OUString TempURL;
+    css::uno::Sequence< sal_Int8 > Data;
+    bool Modified = false;
+
+    /// set by the main thread, if the document was saved or closed meanwhile
+    std::atomic< bool > Cancelled { false };
+    /// set by the worker thread; Failed may be read only after Done is set
+    std::atomic< bool > Done { false };
+    bool Failed = false;
+};
+
+class BackgroundSaveTask : public comphelper::ThreadTask
+{
+    std::shared_ptr< BackgroundSave > m_pSave;
+
+public:
+    BackgroundSaveTask(const std::shared_ptr< comphelper::ThreadTaskTag >& pTag,
+                       std::shared_ptr< BackgroundSave > pSave)
+        : ThreadTask(pTag)
+        , m_pSave(std::move(pSave))
+    {
+    }
+
+    virtual void doWork() override
+    {
+        // write in chunks, so a cancellation does not have to wait for the whole file
+        const sal_uInt64 nChunkSize = 1024 * 1024;
+
+        // implts_generateNewTempURL() created the (empty) file already
+        osl::File aFile(m_pSave->TempURL);
+        osl::FileBase::RC nRC = aFile.open(osl_File_OpenFlag_Write);
+        if (nRC == osl::FileBase::E_NOENT)
+            nRC = aFile.open(osl_File_OpenFlag_Write | osl_File_OpenFlag_Create);
+        bool bOk = nRC == osl::FileBase::E_None && aFile.setSize(0) == osl::FileBase::E_None;
+
+        const sal_Int8* pData = m_pSave->Data.getConstArray();
+        const sal_uInt64 nSize = m_pSave->Data.getLength();
+        sal_uInt64 nPos = 0;
+        while (bOk && nPos < nSize && !m_pSave->Cancelled)
+        {
+            sal_uInt64 nWritten = 0;
+            bOk = aFile.write(pData + nPos, std::min(nSize - nPos, nChunkSize), nWritten)
+                      == osl::FileBase::E_None
+                  && nWritten != 0;
+            nPos += nWritten;
+        }
+        bOk = bOk && aFile.sync() == osl::FileBase::E_None;
+        aFile.close();
+
+        if (!bOk || m_pSave->Cancelled)
+            osl::File::remove(m_pSave->TempURL);
+        m_pSave->Data = css::uno::Sequence< sal_Int8 >();
+        m_pSave->Failed = !bOk;
+        m_pSave->Done.store(true, std::memory_order_release);
+    }
+};
+
+/** upper limits [ms] of the buckets of the AutoSaveFreezeHistogram property,
+    the last bucket counts everything above */
+constexpr std::array< sal_Int32, 7 > AUTOSAVE_FREEZE_LIMITS { 50, 100, 250, 500, 1000, 2500, 5000 };
+
 /**
     implements the functionality of AutoSave and AutoRecovery
     of documents - including features of an EmergencySave in
@@ -488,6 +574,25 @@ private:
     sal_Int32 m_nMinSpaceDocSave;
     sal_Int32 m_nMinSpaceConfigSave;
 
+    /** @short  recovery files, which are still written by a worker thread.
+        @descr  see implts_saveOneDoc() and implts_finishBackgroundSaves().
+                Guarded by our mutex.
+     */
+    ::std::vector< std::shared_ptr< BackgroundSave > > m_lBackgroundSaves;
+    std::shared_ptr< comphelper::ThreadTaskTag > m_pBackgroundSaveTag;
+
+    /** @short  polls for finished background saves.
+        @remark must lock SolarMutex to use
+     */
+    Timer m_aBackgroundSaveTimer;
+
+    /** @short  how long saving a document blocked the main thread.
+        @descr  Bucket i counts the saves, which took less than
+                AUTOSAVE_FREEZE_LIMITS[i] ms, the last one all others.
+                Guarded by our mutex.
+     */
+    std::array< sal_Int32, AUTOSAVE_FREEZE_LIMITS.size() + 1 > m_aFreezeHistogram;
+
 // interface
 
 public:
@@ -675,6 +780,29 @@ private:
      */
     DECL_LINK(implts_asyncDispatch, LinkParamNone*, void);
 
+    /** @short  callback of the timer polling for finished background saves.
+     */
+    DECL_LINK(implts_backgroundSaveTimerExpired, Timer*, void);
+
+    /** @short  takes over the recovery files, which were written
+                completely by the worker threads meanwhile.
+        @descr  Only now such a file replaces the previous one inside
+                the RecoveryList, and the previous one is removed.
+        @param  bWait
+                wait for all pending writes first.
+        @threadsafe
+     */
+    void implts_finishBackgroundSaves(bool bWait);
+
+    /** @short  abandon a pending background save of the given document,
+                e.g. because it was saved by the user or closed.
+        @threadsafe
+     */
+    void implts_cancelBackgroundSave(const css::uno::Reference< css::frame::XModel >& xDocument);
+
+    /** @short  add one save to the AutoSaveFreezeHistogram. */
+    void implts_recordFreezeTime(sal_Int64 nMilliSeconds);
+
     /** @short  implements the dispatch real. */
     void implts_dispatch(const DispatchParams& aParams);
 
@@ -1277,6 +1405,8 @@ AutoRecovery::AutoRecovery(css::uno::Reference< css::uno::XComponentContext >  x
     , m_nDocCacheLock           (0                                                  )
     , m_nMinSpaceDocSave        (MIN_DISCSPACE_DOCSAVE                              )
     , m_nMinSpaceConfigSave     (MIN_DISCSPACE_CONFIGSAVE                           )
+    , m_aBackgroundSaveTimer( "framework::AutoRecovery m_aBackgroundSaveTimer" )
+    , m_aFreezeHistogram        (                                                   )
 {
 }
 
@@ -1291,17 +1421,37 @@ void AutoRecovery::initListeners()
     // Note: Its only active, if the timer will be started ...
     SolarMutexGuard g;
     m_aTimer.SetInvokeHandler(LINK(this, AutoRecovery, implts_timerExpired));
+    m_aBackgroundSaveTimer.SetInvokeHandler(LINK(this, AutoRecovery, implts_backgroundSaveTimerExpired));
+    m_aBackgroundSaveTimer.SetTimeout(100);
 }
 
 AutoRecovery::~AutoRecovery()
 {
     assert(!m_aTimer.IsActive());
+    assert(!m_aBackgroundSaveTimer.IsActive());
 }
 
 void AutoRecovery::disposing()
 {
     implts_stopTimer();
+
+    // nobody will take over these files any longer
+    ::std::vector< std::shared_ptr< BackgroundSave > > lPending;
+    std::shared_ptr< comphelper::ThreadTaskTag > pTag;
+    /* SAFE */ {
+    osl::MutexGuard g(cppu::WeakComponentImplHelperBase::rBHelper.rMutex);
+    lPending.swap(m_lBackgroundSaves);
+    pTag = m_pBackgroundSaveTag;
+    } /* SAFE */
+    for (auto const& pSave : lPending)
+        pSave->Cancelled = true;
+    if (pTag)
+        comphelper::ThreadPool::getSharedOptimalPool().waitUntilDone(pTag);
+    for (auto const& pSave : lPending)
+        osl::File::remove(pSave->TempURL);
+
     SolarMutexGuard g;
+    m_aBackgroundSaveTimer.Stop();
     m_xAsyncDispatcher.reset();
 }
 
@@ -2563,6 +2713,8 @@ void AutoRecovery::implts_registerDocument(const css::uno::Reference< css::frame
 void AutoRecovery::implts_deregisterDocument(const css::uno::Reference< css::frame::XModel >& xDocument     ,
                                                    bool                                   bStopListening)
 {
+    implts_cancelBackgroundSave(xDocument);
+
     AutoRecovery::TDocumentInfo aInfo;
     /* SAFE */ {
     osl::MutexGuard g(cppu::WeakComponentImplHelperBase::rBHelper.rMutex);
@@ -2676,6 +2828,9 @@ void AutoRecovery::implts_updateDocumentUsedForSavingState(const css::uno::Refer
 
 void AutoRecovery::implts_markDocumentAsSaved(const css::uno::Reference< css::frame::XModel >& xDocument)
 {
+    // the recovery file which is still written is outdated by now
+    implts_cancelBackgroundSave(xDocument);
+
     CacheLockGuard aCacheLock(this, cppu::WeakComponentImplHelperBase::rBHelper.rMutex, m_nDocCacheLock, LOCK_FOR_CACHE_USE);
 
     AutoRecovery::TDocumentInfo aInfo;
@@ -2886,6 +3041,18 @@ bool lc_checkIfSaveForbiddenByArguments(AutoRecovery::TDocumentInfo const & rInf
     return bNoAutoSave;
 }
 
+/** @short  check, if the document can be exported into memory, so writing
+            its recovery file can be left to a worker thread.
+
+    @descr  Database documents store their recovery data into sub storages
+            of the target location themselves, they need a real file.
+*/
+bool lc_canSaveInBackground(const css::uno::Reference< css::frame::XModel >& xDocument)
+{
+    css::uno::Reference< css::lang::XServiceInfo > xInfo(xDocument, css::uno::UNO_QUERY);
+    return xInfo.is() && !xInfo->supportsService(u"com.sun.star.sdb.OfficeDatabaseDocument"_ustr);
+}
+
 AutoRecovery::ETimerType AutoRecovery::implts_saveDocs(       bool        bAllowUserIdleLoop,
                                                               bool        bRemoveLockFiles,
                                                         const DispatchParams* pParams           )
@@ -2907,6 +3074,10 @@ AutoRecovery::ETimerType AutoRecovery::implts_saveDocs(       bool        bAllow
 
     Job eJob = m_eJob;
 
+    // Emergency- and SessionSave must not leave anything behind, which is
+    // still written in the background.
+    implts_finishBackgroundSaves(bool(eJob & (Job::EmergencySave | Job::SessionSave)));
+
     CacheLockGuard aCacheLock(this, cppu::WeakComponentImplHelperBase::rBHelper.rMutex, m_nDocCacheLock, LOCK_FOR_CACHE_USE);
 
     const sal_Int64 nConfiguredAutoSaveInterval
@@ -2943,6 +3114,12 @@ AutoRecovery::ETimerType AutoRecovery::implts_saveDocs(       bool        bAllow
         if ((aInfo.DocumentState & DocState::Handled) == DocState::Handled)
             continue;
 
+        // the previous recovery file of this document is still written in the background
+        if (std::any_of(m_lBackgroundSaves.begin(), m_lBackgroundSaves.end(),
+                        [&aInfo](const std::shared_ptr< BackgroundSave >& pSave)
+                        { return pSave->Document.get() == aInfo.Document; }))
+            continue;
+
         // don't allow implts_deregisterDocument to remove from RecoveryList during shutdown jobs
         if (m_eJob & (Job::EmergencySave | Job::SessionSave))
             aInfo.IgnoreClosing = true;
@@ -3074,6 +3251,8 @@ void AutoRecovery::implts_saveOneDoc(const OUString&
     if (!rInfo.Document.is())
         return;
 
+    const auto aStartTime = std::chrono::steady_clock::now();
+
     utl::MediaDescriptor lOldArgs(rInfo.Document->getArgs());
     implts_generateNewTempURL(sBackupPath, lOldArgs, rInfo);
 
@@ -3146,14 +3325,46 @@ void AutoRecovery::implts_saveOneDoc(const OUString&
     const bool bRemoveIt
         = xModify.is() && !xModify->isModified() && bUserAutoSaved && !(m_eJob & Job::SessionSave);
 
+    // A normal AutoSave only exports the document into memory here. Writing the
+    // file is left to a worker thread, see BackgroundSave. Emergency- and
+    // SessionSave have to be finished before we return.
+    std::shared_ptr< BackgroundSave > pBackgroundSave;
+    if (!bRemoveIt && !(m_eJob & (Job::EmergencySave | Job::SessionSave))
+        && lc_canSaveInBackground(rInfo.Document))
+    {
+        pBackgroundSave = std::make_shared< BackgroundSave >();
+        css::uno::Reference< css::io::XOutputStream > xOut(
+            new comphelper::OSequenceOutputStream(pBackgroundSave->Data));
+        try
+        {
+            utl::MediaDescriptor lStreamArgs(lNewArgs);
+            lStreamArgs[utl::MediaDescriptor::PROP_OUTPUTSTREAM] <<= xOut;
+            xDocRecover->storeToRecoveryFile(u"private:stream"_ustr,
+                                             lStreamArgs.getAsConstPropertyValueList());
+            try
+            {
+                // shrinks Data to the size written, if the filter did not close it already
+                xOut->closeOutput();
+            }
+            catch (const css::io::NotConnectedException&)
+            {
+            }
+        }
+        catch (const css::uno::Exception&)
+        {
+            TOOLS_WARN_EXCEPTION("fwk.autorecovery", "export into memory failed, saving synchronously");
+            pBackgroundSave.reset();
+        }
+    }
+
     sal_Int32 nRetry = RETRY_STORE_ON_FULL_DISC_FOREVER;
     bool  bError = false;
     do
     {
         try
         {
-            // skip recovery if it was already saved in-place.
-            if (!bRemoveIt)
+            // skip recovery if it was already saved in-place or exported into memory.
+            if (!bRemoveIt && !pBackgroundSave)
                 xDocRecover->storeToRecoveryFile(rInfo.NewTempURL,
                                                  lNewArgs.getAsConstPropertyValueList());
 
@@ -3230,6 +3441,39 @@ void AutoRecovery::implts_saveOneDoc(const OUString&
     // make sure the progress is not referred any longer
     impl_forgetProgress(rInfo, lNewArgs, css::uno::Reference< css::frame::XFrame >());
 
+    if (pBackgroundSave)
+    {
+        // Until the worker is done, the RecoveryList keeps pointing to the
+        // previous recovery file (OldTempURL), the new one stays NewTempURL.
+        implts_flushConfigItem(rInfo, /*bRemoveIt=*/false, /*bAllowAdd=*/false);
+        implts_startModifyListeningOnDoc(rInfo);
+
+        pBackgroundSave->Document = rInfo.Document;
+        pBackgroundSave->TempURL = rInfo.NewTempURL;
+        pBackgroundSave->Modified = bModified;
+
+        std::shared_ptr< comphelper::ThreadTaskTag > pTag;
+        /* SAFE */ {
+        osl::MutexGuard g(cppu::WeakComponentImplHelperBase::rBHelper.rMutex);
+        if (!m_pBackgroundSaveTag)
+            m_pBackgroundSaveTag = comphelper::ThreadPool::createThreadTaskTag();
+        pTag = m_pBackgroundSaveTag;
+        m_lBackgroundSaves.push_back(pBackgroundSave);
+        } /* SAFE */
+        comphelper::ThreadPool::getSharedOptimalPool().pushTask(
+            std::make_unique< BackgroundSaveTask >(pTag, pBackgroundSave));
+
+        {
+            SolarMutexGuard g;
+            if (!m_aBackgroundSaveTimer.IsActive())
+                m_aBackgroundSaveTimer.Start();
+        }
+
+        implts_recordFreezeTime(std::chrono::duration_cast< std::chrono::milliseconds >(
+                                    std::chrono::steady_clock::now() - aStartTime).count());
+        return;
+    }
+
     // try to remove the old temp file.
     // Ignore any error here. We have a new temp file, which is up to date.
     // The only thing is: we fill the disk with temp files, if we can't remove old ones :-)
@@ -3244,6 +3488,129 @@ void AutoRecovery::implts_saveOneDoc(const OUString&
     implts_startModifyListeningOnDoc(rInfo);
 
     AutoRecovery::st_impl_removeFile(sRemoveFile);
+
+    implts_recordFreezeTime(std::chrono::duration_cast< std::chrono::milliseconds >(
+                                std::chrono::steady_clock::now() - aStartTime).count());
+}
+
+IMPL_LINK_NOARG(AutoRecovery, implts_backgroundSaveTimerExpired, Timer*, void)
+{
+    implts_finishBackgroundSaves(false);
+
+    bool bPending;
+    /* SAFE */ {
+    osl::MutexGuard g(cppu::WeakComponentImplHelperBase::rBHelper.rMutex);
+    bPending = !m_lBackgroundSaves.empty();
+    } /* SAFE */
+    if (bPending)
+        m_aBackgroundSaveTimer.Start();
+}
+
+void AutoRecovery::implts_finishBackgroundSaves(bool bWait)
+{
+    std::shared_ptr< comphelper::ThreadTaskTag > pTag;
+    /* SAFE */ {
+    osl::MutexGuard g(cppu::WeakComponentImplHelperBase::rBHelper.rMutex);
+    if (m_lBackgroundSaves.empty())
+        return;
+    pTag = m_pBackgroundSaveTag;
+    } /* SAFE */
+
+    if (bWait)
+        comphelper::ThreadPool::getSharedOptimalPool().waitUntilDone(pTag, false);
+
+    ::std::vector< std::shared_ptr< BackgroundSave > > lDone;
+    /* SAFE */ {
+    osl::MutexGuard g(cppu::WeakComponentImplHelperBase::rBHelper.rMutex);
+    auto pFirstDone = std::stable_partition(
+        m_lBackgroundSaves.begin(), m_lBackgroundSaves.end(),
+        [](const std::shared_ptr< BackgroundSave >& pSave)
+        { return !pSave->Done.load(std::memory_order_acquire); });
+    lDone.assign(pFirstDone, m_lBackgroundSaves.end());
+    m_lBackgroundSaves.erase(pFirstDone, m_lBackgroundSaves.end());
+    } /* SAFE */
+
+    for (auto const& pSave : lDone)
+    {
+        AutoRecovery::TDocumentInfo aInfo;
+        bool bTakeOver = false;
+        /* SAFE */ {
+        CacheLockGuard aCacheLock(this, cppu::WeakComponentImplHelperBase::rBHelper.rMutex, m_nDocCacheLock, LOCK_FOR_CACHE_USE);
+        osl::MutexGuard g(cppu::WeakComponentImplHelperBase::rBHelper.rMutex);
+        AutoRecovery::TDocumentList::iterator pIt = AutoRecovery::impl_searchDocument(m_lDocCache, pSave->Document.get());
+        // NewTempURL was reset, if the user saved the document meanwhile
+        if (!pSave->Cancelled && pIt != m_lDocCache.end() && pIt->NewTempURL == pSave->TempURL)
+        {
+            aInfo = *pIt;
+            bTakeOver = true;
+        }
+        } /* SAFE */
+
+        if (!bTakeOver)
+        {
+            AutoRecovery::st_impl_removeFile(pSave->TempURL);
+            continue;
+        }
+
+        OUString sRemoveFile;
+        if (pSave->Failed)
+        {
+            SAL_WARN("fwk.autorecovery", "could not write recovery file " << pSave->TempURL);
+            aInfo.NewTempURL.clear();
+            aInfo.DocumentState &= ~DocState::Succeeded;
+            aInfo.DocumentState |=  DocState::Incomplete;
+            implts_flushConfigItem(aInfo, /*bRemoveIt=*/false, /*bAllowAdd=*/false);
+        }
+        else
+        {
+            sRemoveFile = aInfo.OldTempURL;
+            aInfo.OldTempURL = aInfo.NewTempURL;
+            aInfo.NewTempURL.clear();
+            // If it is modified, a recovery file has just been created, so add to RecoveryList.
+            implts_flushConfigItem(aInfo, /*bRemoveIt=*/false, /*bAllowAdd=*/pSave->Modified);
+        }
+
+        /* SAFE */ {
+        CacheLockGuard aCacheLock(this, cppu::WeakComponentImplHelperBase::rBHelper.rMutex, m_nDocCacheLock, LOCK_FOR_CACHE_USE);
+        osl::MutexGuard g(cppu::WeakComponentImplHelperBase::rBHelper.rMutex);
+        AutoRecovery::TDocumentList::iterator pIt = AutoRecovery::impl_searchDocument(m_lDocCache, pSave->Document.get());
+        if (pIt != m_lDocCache.end())
+        {
+            pIt->OldTempURL = aInfo.OldTempURL;
+            pIt->NewTempURL = aInfo.NewTempURL;
+            if (pSave->Failed)
+            {
+                pIt->DocumentState &= ~DocState::Succeeded;
+                pIt->DocumentState |=  DocState::Incomplete;
+            }
+        }
+        } /* SAFE */
+
+        AutoRecovery::st_impl_removeFile(sRemoveFile);
+    }
+}
+
+void AutoRecovery::implts_cancelBackgroundSave(const css::uno::Reference< css::frame::XModel >& xDocument)
+{
+    /* SAFE */ {
+    osl::MutexGuard g(cppu::WeakComponentImplHelperBase::rBHelper.rMutex);
+    for (auto const& pSave : m_lBackgroundSaves)
+    {
+        if (pSave->Document.get() == xDocument)
+            pSave->Cancelled = true;
+    }
+    } /* SAFE */
+}
+
+void AutoRecovery::implts_recordFreezeTime(sal_Int64 nMilliSeconds)
+{
+    SAL_INFO("fwk.autorecovery", "AutoRecovery blocked the main thread for " << nMilliSeconds << " ms");
+
+    auto pLimit = std::upper_bound(AUTOSAVE_FREEZE_LIMITS.begin(), AUTOSAVE_FREEZE_LIMITS.end(), nMilliSeconds);
+    /* SAFE */ {
+    osl::MutexGuard g(cppu::WeakComponentImplHelperBase::rBHelper.rMutex);
+    ++m_aFreezeHistogram[pLimit - AUTOSAVE_FREEZE_LIMITS.begin()];
+    } /* SAFE */
 }
 
 AutoRecovery::ETimerType AutoRecovery::implts_openDocs(const DispatchParams& aParams)
@@ -4037,6 +4404,10 @@ void SAL_CALL AutoRecovery::getFastPropertyValue(css::uno::Any& aValue ,
         case AUTORECOVERY_PROPHANDLE_EXISTS_SESSIONDATA :
                 aValue <<= officecfg::Office::Recovery::RecoveryInfo::SessionData::get();
                 break;
+
+        case AUTORECOVERY_PROPHANDLE_AUTOSAVE_FREEZEHISTOGRAM :
+                aValue <<= css::uno::Sequence< sal_Int32 >(m_aFreezeHistogram.data(), m_aFreezeHistogram.size());
+                break;
     }
 }
 
@@ -4044,6 +4415,7 @@ css::uno::Sequence< css::beans::Property > impl_getStaticPropertyDescriptor()
 {
     return
     {
+        css::beans::Property( AUTORECOVERY_PROPNAME_AUTOSAVE_FREEZEHISTOGRAM, AUTORECOVERY_PROPHANDLE_AUTOSAVE_FREEZEHISTOGRAM, cppu::UnoType< css::uno::Sequence< sal_Int32 > >::get(), css::beans::PropertyAttribute::TRANSIENT | css::beans::PropertyAttribute::READONLY ),
         css::beans::Property( AUTORECOVERY_PROPNAME_CRASHED            , AUTORECOVERY_PROPHANDLE_CRASHED            , cppu::UnoType<bool>::get() , css::beans::PropertyAttribute::TRANSIENT | css::beans::PropertyAttribute::READONLY ),
         css::beans::Property( AUTORECOVERY_PROPNAME_EXISTS_RECOVERYDATA, AUTORECOVERY_PROPHANDLE_EXISTS_RECOVERYDATA, cppu::UnoType<bool>::get() , css::beans::PropertyAttribute::TRANSIENT | css::beans::PropertyAttribute::READONLY ),
         css::beans::Property( AUTORECOVERY_PROPNAME_EXISTS_SESSIONDATA , AUTORECOVERY_PROPHANDLE_EXISTS_SESSIONDATA , cppu::UnoType<bool>::get() , css::beans::PropertyAttribute::TRANSIENT | css::beans::PropertyAttribute::READONLY ),
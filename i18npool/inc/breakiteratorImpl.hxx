@@ -22,6 +22,7 @@
 #include <com/sun/star/i18n/XBreakIterator.hpp>
 #include <cppuhelper/implbase.hxx>
 
+#include <mutex>
 #include <utility>
 #include <vector>
 
@@ -98,8 +99,6 @@ public:
     virtual css::uno::Sequence< OUString > SAL_CALL getSupportedServiceNames() override;
 
     static sal_Int16 getScriptClass(sal_uInt32 currentChar);
-protected:
-    css::i18n::Boundary result; // for word break iterator
 
 private:
 
@@ -108,6 +107,9 @@ private:
         css::lang::Locale aLocale;
         css::uno::Reference < XBreakIterator > xBI;
     };
+    // guards lookupTable, aLocale and xBI: the service is shared, e.g. by all
+    // of Writer, and may be called from several threads
+    std::mutex                                          maMutex;
     std::vector<lookupTableItem>                        lookupTable;
     css::lang::Locale                                   aLocale;
     css::uno::Reference < XBreakIterator >              xBI;
@@ -116,7 +118,7 @@ private:
     /// @throws css::uno::RuntimeException
     bool createLocaleSpecificBreakIterator( const OUString& aLocaleName );
     /// @throws css::uno::RuntimeException
-    const css::uno::Reference < XBreakIterator > & getLocaleSpecificBreakIterator( const css::lang::Locale& rLocale );
+    css::uno::Reference < XBreakIterator > getLocaleSpecificBreakIterator( const css::lang::Locale& rLocale );
 
 };
 
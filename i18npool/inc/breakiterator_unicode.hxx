@@ -73,6 +73,18 @@ protected:
     OUString cBreakIterator;
     const char *lineRule;
 
+    /** Load (or pick the cached) ICU iterator for the given type and locale and
+        set rText on it unless it already is.
+
+        All state lives in thread_local caches, so a single instance may be
+        used from several threads at the same time.
+
+        @throws css::uno::RuntimeException
+     */
+    icu::BreakIterator* loadICUBreakIterator(const css::lang::Locale& rLocale,
+        sal_Int16 rBreakType, sal_Int16 rWordType, const char* name, const OUString& rText);
+
+public:
     /** Used as map value. */
     struct BI_ValueData
     {
@@ -89,18 +101,15 @@ protected:
         }
     };
 
+    /** Last used iterator of one break type, and what it was looked up for. */
     struct BI_Data
     {
         std::shared_ptr< BI_ValueData > mpValue;
         OString                         maBIMapKey;
-    } character, sentence, line, *icuBI;
-    BI_Data words[4]; // 4 is css::i18n::WordType enumeration size
-
-    /// @throws css::uno::RuntimeException
-    void loadICUBreakIterator(const css::lang::Locale& rLocale,
-        sal_Int16 rBreakType, sal_Int16 rWordType, const char* name, const OUString& rText);
+        css::lang::Locale               maLocale;
+        const char*                     mpRule = nullptr;
+    };
 
-public:
     typedef std::unordered_map< OString, std::shared_ptr< BI_ValueData > > BIMap;
 };
 
@@ -21,8 +21,14 @@
 #include <com/sun/star/i18n/XExtendedTransliteration.hpp>
 #include <cppuhelper/implbase.hxx>
 #include <com/sun/star/lang/XServiceInfo.hpp>
+#include <o3tl/lru_map.hxx>
 #include <sal/types.h>
 
+#include <array>
+#include <atomic>
+#include <mutex>
+#include <utility>
+
 namespace com::sun::star::i18n { class XLocaleData5; }
 namespace com::sun::star::uno { class XComponentContext; }
 
@@ -90,12 +96,34 @@ private:
     css::uno::Reference< css::i18n::XLocaleData5 > mxLocaledata;
     css::uno::Reference< css::i18n::XExtendedTransliteration > caseignore;
 
+    /** The loaded cascade fused into a single table for U+0000..U+00FF, where
+        every entry maps one char to exactly one char (LATIN1_COMPLEX if it
+        does not). Built on first use after loading, see getLatin1Map(). */
+    static constexpr sal_Unicode LATIN1_COMPLEX = 0xFFFF;
+    enum class Latin1MapState : sal_uInt8 { Unknown, Valid, Unusable };
+    std::array<sal_Unicode, 256> maLatin1Map;
+    std::atomic<Latin1MapState> meLatin1MapState;
+
+    /** Memoised results of transliterate() for whole strings that could not take
+        the Latin-1 path, e.g. Calc shared strings compared over and over again.
+        Guarded by maCacheMutex, which also serialises building maLatin1Map. */
+    std::mutex maCacheMutex;
+    o3tl::lru_map< OUString, std::pair< OUString, css::uno::Sequence< sal_Int32 > > > maCache;
+
     /// @throws css::uno::RuntimeException
     bool loadModuleByName( std::u16string_view implName,
         css::uno::Reference<css::i18n::XExtendedTransliteration> & body, const css::lang::Locale& rLocale);
 
     void clear();
 
+    /// @throws css::uno::RuntimeException
+    OUString transliterateCascade( const OUString& inStr, sal_Int32 startPos, sal_Int32 nCount,
+        css::uno::Sequence< sal_Int32 >& offset );
+
+    const std::array<sal_Unicode, 256>* getLatin1Map();
+    bool transliterateLatin1( const OUString& inStr, sal_Int32 startPos, sal_Int32 nCount,
+        css::uno::Sequence< sal_Int32 >& offset, OUString& rResult );
+
     /// @throws css::uno::RuntimeException
     void loadBody( OUString const &implName,
         css::uno::Reference< css::i18n::XExtendedTransliteration >& body );
@@ -18,8 +18,12 @@
 
 #include <string.h>
 
+#include <algorithm>
+#include <atomic>
 #include <stack>
 #include <string_view>
+#include <thread>
+#include <vector>
 
 using namespace ::com::sun::star;
 
@@ -51,6 +55,7 @@ public:
     void testLegacySurrogatePairs();
     void testWordCount();
     void testDictionaryIteratorLanguages();
+    void testConcurrentUse();
 
     CPPUNIT_TEST_SUITE(TestBreakIterator);
     CPPUNIT_TEST(testLineBreaking);
@@ -74,6 +79,7 @@ public:
     CPPUNIT_TEST(testLegacySurrogatePairs);
     CPPUNIT_TEST(testWordCount);
     CPPUNIT_TEST(testDictionaryIteratorLanguages);
+    CPPUNIT_TEST(testConcurrentUse);
     CPPUNIT_TEST_SUITE_END();
 
 private:
@@ -2293,6 +2299,70 @@ void TestBreakIterator::testDictionaryIteratorLanguages()
     }
 }
 
+// The service is shared (e.g. by all of Writer) and may be used from worker
+// threads: per-thread ICU iterator state must not leak between callers
+// iterating different texts in different locales at the same time.
+void TestBreakIterator::testConcurrentUse()
+{
+    struct Job
+    {
+        OUString aText;
+        lang::Locale aLocale;
+        std::vector<i18n::Boundary> aExpected;
+    };
+    std::vector<Job> aJobs{
+        { u"The quick brown fox jumps over the lazy dog."_ustr, { u"en"_ustr, u"US"_ustr, u""_ustr }, {} },
+        { u"Der schnelle braune Fuchs springt über den faulen Hund."_ustr,
+          { u"de"_ustr, u"DE"_ustr, u""_ustr }, {} },
+        { u"Le vif renard brun saute par-dessus le chien paresseux."_ustr,
+          { u"fr"_ustr, u"FR"_ustr, u""_ustr }, {} },
+        { u"Kværkende ærlig håndværker, ikke sandt?"_ustr,
+          { u"da"_ustr, u"DK"_ustr, u""_ustr }, {} },
+    };
+
+    auto collectWords = [this](const Job& rJob) {
+        std::vector<i18n::Boundary> aBounds;
+        i18n::Boundary aBound = m_xBreak->getWordBoundary(
+            rJob.aText, 0, rJob.aLocale, i18n::WordType::DICTIONARY_WORD, true);
+        while (aBound.endPos < rJob.aText.getLength())
+        {
+            aBounds.push_back(aBound);
+            aBound = m_xBreak->nextWord(rJob.aText, aBound.startPos, rJob.aLocale,
+                                        i18n::WordType::DICTIONARY_WORD);
+            if (aBound.endPos <= aBounds.back().startPos)
+                break;
+        }
+        aBounds.push_back(aBound);
+        return aBounds;
+    };
+
+    for (auto& rJob : aJobs)
+        rJob.aExpected = collectWords(rJob);
+
+    std::atomic<int> nFailures(0);
+    std::vector<std::thread> aThreads;
+    for (size_t nThread = 0; nThread < 4; ++nThread)
+    {
+        aThreads.emplace_back([&, nThread]() {
+            for (int nRound = 0; nRound < 200; ++nRound)
+            {
+                const Job& rJob = aJobs[(nThread + nRound) % aJobs.size()];
+                const std::vector<i18n::Boundary> aBounds = collectWords(rJob);
+                if (aBounds.size() != rJob.aExpected.size()
+                    || !std::equal(aBounds.begin(), aBounds.end(), rJob.aExpected.begin(),
+                                   [](const i18n::Boundary& a, const i18n::Boundary& b) {
+                                       return a.startPos == b.startPos && a.endPos == b.endPos;
+                                   }))
+                    ++nFailures;
+            }
+        });
+    }
+    for (auto& rThread : aThreads)
+        rThread.join();
+
+    CPPUNIT_ASSERT_EQUAL(0, nFailures.load());
+}
+
 void TestBreakIterator::setUp()
 {
     BootstrapFixtureBase::setUp();
@@ -16,6 +16,7 @@
 #include <com/sun/star/i18n/Transliteration.hpp>
 #include <com/sun/star/i18n/TransliterationModulesNew.hpp>
 #include <com/sun/star/i18n/XExtendedTransliteration.hpp>
+#include <com/sun/star/lang/Locale.hpp>
 #include <com/sun/star/uno/Reference.hxx>
 #include <cppuhelper/bootstrap.hxx>
 
@@ -174,10 +175,76 @@ public:
         transliteration_->loadModuleByImplName(u"TextToPinyin_zh_CN"_ustr, {});
     }
 
+    void testLowercaseLatin1()
+    {
+        transliteration_->loadModuleNew(
+            { css::i18n::TransliterationModulesNew_UPPERCASE_LOWERCASE },
+            css::lang::Locale(u"en"_ustr, u"US"_ustr, u""_ustr));
+
+        // Plain Latin-1 input is handled by the precomputed table, the offsets have to be the
+        // same as the module itself reports
+        css::uno::Sequence<sal_Int32> offset;
+        const OUString aLatin1(u"Hello W\u00d6RLD"_ustr);
+        CPPUNIT_ASSERT_EQUAL(u"hello w\u00f6rld"_ustr,
+                             transliteration_->transliterate(aLatin1, 0, 11, offset));
+        CPPUNIT_ASSERT_EQUAL(sal_Int32(11), offset.getLength());
+        CPPUNIT_ASSERT_EQUAL(sal_Int32(10), offset[10]);
+        CPPUNIT_ASSERT_EQUAL(u"w\u00f6rld"_ustr,
+                             transliteration_->transliterate(aLatin1, 6, 5, offset));
+        CPPUNIT_ASSERT_EQUAL(sal_Int32(5), offset.getLength());
+        CPPUNIT_ASSERT_EQUAL(sal_Int32(6), offset[0]);
+        CPPUNIT_ASSERT_EQUAL(sal_Int32(10), offset[4]);
+
+        // Anything else goes through the module and the memo cache; the second call must return
+        // the same as the first
+        for (int i = 0; i < 2; ++i)
+        {
+            CPPUNIT_ASSERT_EQUAL(
+                u"\u03b1\u03b2\u03b3 abc"_ustr,
+                transliteration_->transliterate(u"\u0391\u0392\u0393 ABC"_ustr, 0, 7, offset));
+            CPPUNIT_ASSERT_EQUAL(sal_Int32(7), offset.getLength());
+            CPPUNIT_ASSERT_EQUAL(sal_Int32(6), offset[6]);
+        }
+
+        // Reloading has to drop the table and the cache
+        transliteration_->loadModuleNew(
+            { css::i18n::TransliterationModulesNew_LOWERCASE_UPPERCASE },
+            css::lang::Locale(u"en"_ustr, u"US"_ustr, u""_ustr));
+        CPPUNIT_ASSERT_EQUAL(u"HELLO"_ustr,
+                             transliteration_->transliterate(u"hello"_ustr, 0, 5, offset));
+        CPPUNIT_ASSERT_EQUAL(
+            u"\u0391\u0392\u0393 ABC"_ustr,
+            transliteration_->transliterate(u"\u03b1\u03b2\u03b3 abc"_ustr, 0, 7, offset));
+    }
+
+    void testTitleAndSentenceCaseLatin1()
+    {
+        // Both only capitalize the first char and lower-case the rest, so they must never go
+        // through the per-char Latin-1 table
+        const css::lang::Locale aLocale(u"en"_ustr, u"US"_ustr, u""_ustr);
+        css::uno::Sequence<sal_Int32> offset;
+
+        transliteration_->loadModuleByImplName(u"TITLE_CASE"_ustr, aLocale);
+        CPPUNIT_ASSERT_EQUAL(u"Hello"_ustr,
+                             transliteration_->transliterate(u"hello"_ustr, 0, 5, offset));
+        CPPUNIT_ASSERT_EQUAL(u"Hello"_ustr,
+                             transliteration_->transliterate(u"hELLO"_ustr, 0, 5, offset));
+        CPPUNIT_ASSERT_EQUAL(u"\u00c4rger"_ustr,
+                             transliteration_->transliterate(u"say \u00e4RGER"_ustr, 4, 5, offset));
+
+        transliteration_->loadModuleByImplName(u"SENTENCE_CASE"_ustr, aLocale);
+        CPPUNIT_ASSERT_EQUAL(u"Hello world"_ustr,
+                             transliteration_->transliterate(u"hello WORLD"_ustr, 0, 11, offset));
+        CPPUNIT_ASSERT_EQUAL(u"Hello world"_ustr,
+                             transliteration_->transliterate(u"hello world"_ustr, 0, 11, offset));
+    }
+
     CPPUNIT_TEST_SUITE(Transliteration);
     CPPUNIT_TEST(testLoadModuleNew);
     CPPUNIT_TEST(testTextToChuyin_zh_TW);
     CPPUNIT_TEST(testTextToPinyin_zh_CN);
+    CPPUNIT_TEST(testLowercaseLatin1);
+    CPPUNIT_TEST(testTitleAndSentenceCaseLatin1);
     CPPUNIT_TEST_SUITE_END();
 
 private:
@@ -121,6 +121,7 @@ static sal_Int32 skipSpace(std::u16string_view Text, sal_Int32 nPos, sal_Int32 l
 Boundary SAL_CALL BreakIteratorImpl::nextWord( const OUString& Text, sal_Int32 nStartPos,
         const Locale& rLocale, sal_Int16 rWordType )
 {
+    Boundary result;
     sal_Int32 len = Text.getLength();
     if( nStartPos < 0 || len == 0 )
         result.endPos = result.startPos = 0;
@@ -151,6 +152,7 @@ static bool isCJK( const Locale& rLocale ) {
 Boundary SAL_CALL BreakIteratorImpl::previousWord( const OUString& Text, sal_Int32 nStartPos,
         const Locale& rLocale, sal_Int16 rWordType)
 {
+    Boundary result;
     sal_Int32 len = Text.getLength();
     if( nStartPos <= 0 || len == 0 ) {
         result.endPos = result.startPos = 0;
@@ -177,6 +179,7 @@ Boundary SAL_CALL BreakIteratorImpl::previousWord( const OUString& Text, sal_Int
 Boundary SAL_CALL BreakIteratorImpl::getWordBoundary( const OUString& Text, sal_Int32 nPos, const Locale& rLocale,
         sal_Int16 rWordType, sal_Bool bDirection )
 {
+    Boundary result;
     sal_Int32 len = Text.getLength();
     if( nPos < 0 || len == 0 )
         result.endPos = result.startPos = 0;
@@ -218,7 +221,7 @@ sal_Bool SAL_CALL BreakIteratorImpl::isBeginWord( const OUString& Text, sal_Int3
 
     if (tmp != nPos) return false;
 
-    result = getWordBoundary(Text, nPos, rLocale, rWordType, true);
+    Boundary result = getWordBoundary(Text, nPos, rLocale, rWordType, true);
 
     return result.startPos == nPos;
 }
@@ -234,7 +237,7 @@ sal_Bool SAL_CALL BreakIteratorImpl::isEndWord( const OUString& Text, sal_Int32
 
     if (tmp != nPos) return false;
 
-    result = getWordBoundary(Text, nPos, rLocale, rWordType, false);
+    Boundary result = getWordBoundary(Text, nPos, rLocale, rWordType, false);
 
     return result.endPos == nPos;
 }
@@ -498,9 +501,10 @@ bool BreakIteratorImpl::createLocaleSpecificBreakIterator(const OUString& aLocal
     return false;
 }
 
-const Reference < XBreakIterator > &
+Reference < XBreakIterator >
 BreakIteratorImpl::getLocaleSpecificBreakIterator(const Locale& rLocale)
 {
+    std::scoped_lock aGuard(maMutex);
     if (xBI.is() && rLocale == aLocale)
         return xBI;
     else if (m_xContext.is()) {
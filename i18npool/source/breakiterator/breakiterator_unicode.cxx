@@ -47,10 +47,25 @@ namespace i18npool {
 // thread_local.
 thread_local static BreakIterator_Unicode::BIMap theBIMap;
 
+namespace {
+
+// The last used iterator per break type. Like theBIMap these reference ICU
+// state, so they are thread_local as well instead of being members: one
+// instance (e.g. the one held by SwBreakIt) may then be used by several
+// threads concurrently, each getting its own iterators.
+struct BI_Slots
+{
+    BreakIterator_Unicode::BI_Data character, sentence, line;
+    BreakIterator_Unicode::BI_Data words[4]; // 4 is css::i18n::WordType enumeration size
+};
+
+}
+
+thread_local static BI_Slots theBISlots;
+
 BreakIterator_Unicode::BreakIterator_Unicode()
     : cBreakIterator( u"com.sun.star.i18n.BreakIterator_Unicode"_ustr )    // implementation name
     , lineRule( "line" )
-    , icuBI( nullptr )
 {
 }
 
@@ -77,17 +92,19 @@ class OOoRuleBasedBreakIterator : public icu::RuleBasedBreakIterator
 }
 
 // loading ICU breakiterator on demand.
-void BreakIterator_Unicode::loadICUBreakIterator(const css::lang::Locale& rLocale,
+icu::BreakIterator* BreakIterator_Unicode::loadICUBreakIterator(const css::lang::Locale& rLocale,
         sal_Int16 rBreakType, sal_Int16 nWordType, const char *rule, const OUString& rText)
 {
     bool bNewBreak = false;
     UErrorCode status = U_ZERO_ERROR;
     sal_Int16 breakType = 0;
+    BI_Data* icuBI = nullptr;
+    const char* const pRequestedRule = rule;
     switch (rBreakType) {
-        case LOAD_CHARACTER_BREAKITERATOR: icuBI=&character; breakType = 3; break;
+        case LOAD_CHARACTER_BREAKITERATOR: icuBI=&theBISlots.character; breakType = 3; break;
         case LOAD_WORD_BREAKITERATOR:
             assert (nWordType >= 0 && nWordType<= WordType::WORD_COUNT);
-            icuBI=&words[nWordType];
+            icuBI=&theBISlots.words[nWordType];
             switch (nWordType) {
                 case WordType::ANY_WORD: break; // odd but previous behavior
                 case WordType::ANYWORD_IGNOREWHITESPACES:
@@ -99,119 +116,100 @@ void BreakIterator_Unicode::loadICUBreakIterator(const css::lang::Locale& rLocal
                     breakType = 2; rule = "count_word"; break;
             }
             break;
-        case LOAD_SENTENCE_BREAKITERATOR: icuBI=&sentence; breakType = 5; break;
-        case LOAD_LINE_BREAKITERATOR: icuBI=&line; breakType = 4; break;
+        case LOAD_SENTENCE_BREAKITERATOR: icuBI=&theBISlots.sentence; breakType = 5; break;
+        case LOAD_LINE_BREAKITERATOR: icuBI=&theBISlots.line; breakType = 4; break;
     }
-
-    // Using the cache map prevents accessing the file system for each
-    // udata_open() where ICU tries first files then data objects. And that for
-    // two fallbacks worst case... for each new allocated EditEngine, layout
-    // cell, ... *ouch*  Also non-rule locale based iterators can be mapped.
-    // This also speeds up loading iterators for alternating or generally more
-    // than one language/locale in that iterators are not constructed and
-    // destroyed en masse.
-    // Four possible keys, locale rule based with break type, locale rule based
-    // only, rule based only, locale based with break type. A fifth global key
-    // for the initial lookup.
-    // Multiple global keys may map to identical value data.
-    // All enums used here should be in the range 0..9 so assert that and avoid
-    // expensive numeric conversion in append() for faster construction of the
-    // always used global key.
-    assert( 0 <= breakType && breakType <= 9 && 0 <= rBreakType && rBreakType <= 9 && 0 <= nWordType && nWordType <= 9);
-    const OString aLangtagStr( LanguageTag::convertToBcp47( rLocale).toUtf8());
-    OStringBuffer aKeyBuf(64);
-    aKeyBuf.append( aLangtagStr + ";" );
-    if (rule)
-        aKeyBuf.append(rule);
-    aKeyBuf.append(";" + OStringChar(static_cast<char>('0'+breakType)) + ";"
-        + OStringChar(static_cast<char>('0'+rBreakType)) + ";"
-        + OStringChar( static_cast<char>('0'+nWordType)));
-    // langtag;rule;breakType;rBreakType;nWordType
-    const OString aBIMapGlobalKey( aKeyBuf.makeStringAndClear());
-
-    if (icuBI->maBIMapKey != aBIMapGlobalKey || !icuBI->mpValue || !icuBI->mpValue->mpBreakIterator)
+    assert(icuBI);
+
+    // Same request as last time in this thread: skip building the map key,
+    // which involves a BCP 47 conversion of the locale, and go straight to
+    // (re)setting the text.
+    const bool bSameRequest = icuBI->mpValue && icuBI->mpValue->mpBreakIterator
+        && icuBI->mpRule == pRequestedRule && icuBI->maLocale == rLocale;
+    if (!bSameRequest)
     {
+        // Using the cache map prevents accessing the file system for each
+        // udata_open() where ICU tries first files then data objects. And that for
+        // two fallbacks worst case... for each new allocated EditEngine, layout
+        // cell, ... *ouch*  Also non-rule locale based iterators can be mapped.
+        // This also speeds up loading iterators for alternating or generally more
+        // than one language/locale in that iterators are not constructed and
+        // destroyed en masse.
+        // Four possible keys, locale rule based with break type, locale rule based
+        // only, rule based only, locale based with break type. A fifth global key
+        // for the initial lookup.
+        // Multiple global keys may map to identical value data.
+        // All enums used here should be in the range 0..9 so assert that and avoid
+        // expensive numeric conversion in append() for faster construction of the
+        // always used global key.
+        assert( 0 <= breakType && breakType <= 9 && 0 <= rBreakType && rBreakType <= 9 && 0 <= nWordType && nWordType <= 9);
+        const OString aLangtagStr( LanguageTag::convertToBcp47( rLocale).toUtf8());
+        OStringBuffer aKeyBuf(64);
+        aKeyBuf.append( aLangtagStr + ";" );
+        if (rule)
+            aKeyBuf.append(rule);
+        aKeyBuf.append(";" + OStringChar(static_cast<char>('0'+breakType)) + ";"
+            + OStringChar(static_cast<char>('0'+rBreakType)) + ";"
+            + OStringChar( static_cast<char>('0'+nWordType)));
+        // langtag;rule;breakType;rBreakType;nWordType
+        const OString aBIMapGlobalKey( aKeyBuf.makeStringAndClear());
+
+        if (icuBI->maBIMapKey != aBIMapGlobalKey || !icuBI->mpValue || !icuBI->mpValue->mpBreakIterator)
+        {
+
+            auto aMapIt( theBIMap.find( aBIMapGlobalKey));
+            bool bInMap = (aMapIt != theBIMap.end());
+            if (bInMap)
+                icuBI->mpValue = aMapIt->second;
+            else
+                icuBI->mpValue.reset();
+
+            if (!bInMap && rule)
+                do
+                {
+                    const uno::Sequence< OUString > breakRules = LocaleDataImpl::get()->getBreakIteratorRules(rLocale);
 
-        auto aMapIt( theBIMap.find( aBIMapGlobalKey));
-        bool bInMap = (aMapIt != theBIMap.end());
-        if (bInMap)
-            icuBI->mpValue = aMapIt->second;
-        else
-            icuBI->mpValue.reset();
-
-        if (!bInMap && rule)
-            do
-            {
-                const uno::Sequence< OUString > breakRules = LocaleDataImpl::get()->getBreakIteratorRules(rLocale);
-
-                status = U_ZERO_ERROR;
-                udata_setAppData("OpenOffice", OpenOffice_dat, &status);
-                if ( !U_SUCCESS(status) )
-                    throw uno::RuntimeException("udata_setAppData returned error " + OUString::createFromAscii(u_errorName(status)));
+                    status = U_ZERO_ERROR;
+                    udata_setAppData("OpenOffice", OpenOffice_dat, &status);
+                    if ( !U_SUCCESS(status) )
+                        throw uno::RuntimeException("udata_setAppData returned error " + OUString::createFromAscii(u_errorName(status)));
 
-                std::shared_ptr<OOoRuleBasedBreakIterator> rbi;
+                    std::shared_ptr<OOoRuleBasedBreakIterator> rbi;
 
-                if (breakRules.getLength() > breakType && !breakRules[breakType].isEmpty())
-                {
-                    // langtag;rule;breakType
-                    const OString aBIMapRuleTypeKey( aLangtagStr + ";" + rule + ";" + OString::number(breakType));
-                    aMapIt = theBIMap.find( aBIMapRuleTypeKey);
-                    bInMap = (aMapIt != theBIMap.end());
-                    if (bInMap)
+                    if (breakRules.getLength() > breakType && !breakRules[breakType].isEmpty())
                     {
-                        icuBI->mpValue = aMapIt->second;
-                        icuBI->maBIMapKey = aBIMapGlobalKey;
-                        theBIMap.insert( std::make_pair( aBIMapGlobalKey, icuBI->mpValue));
-                        break;  // do
-                    }
-
-                    rbi = std::make_shared<OOoRuleBasedBreakIterator>(udata_open("OpenOffice", "brk",
-                        OUStringToOString(breakRules[breakType], RTL_TEXTENCODING_ASCII_US).getStr(), &status), status);
+                        // langtag;rule;breakType
+                        const OString aBIMapRuleTypeKey( aLangtagStr + ";" + rule + ";" + OString::number(breakType));
+                        aMapIt = theBIMap.find( aBIMapRuleTypeKey);
+                        bInMap = (aMapIt != theBIMap.end());
+                        if (bInMap)
+                        {
+                            icuBI->mpValue = aMapIt->second;
+                            icuBI->maBIMapKey = aBIMapGlobalKey;
+                            theBIMap.insert( std::make_pair( aBIMapGlobalKey, icuBI->mpValue));
+                            break;  // do
+                        }
 
-                    if (U_SUCCESS(status))
-                    {
-                        icuBI->mpValue = std::make_shared<BI_ValueData>();
-                        icuBI->mpValue->mpBreakIterator = rbi;
-                        theBIMap.insert( std::make_pair( aBIMapRuleTypeKey, icuBI->mpValue));
-                    }
-                    else
-                    {
-                        rbi.reset();
-                    }
-                }
-                else
-                {
-                    // language;rule (not langtag, unless we'd actually load such)
-                    OString aLanguage( LanguageTag( rLocale).getLanguage().toUtf8());
-                    const OString aBIMapRuleKey( aLanguage + ";" + rule);
-                    aMapIt = theBIMap.find( aBIMapRuleKey);
-                    bInMap = (aMapIt != theBIMap.end());
-                    if (bInMap)
-                    {
-                        icuBI->mpValue = aMapIt->second;
-                        icuBI->maBIMapKey = aBIMapGlobalKey;
-                        theBIMap.insert( std::make_pair( aBIMapGlobalKey, icuBI->mpValue));
-                        break;  // do
-                    }
+                        rbi = std::make_shared<OOoRuleBasedBreakIterator>(udata_open("OpenOffice", "brk",
+                            OUStringToOString(breakRules[breakType], RTL_TEXTENCODING_ASCII_US).getStr(), &status), status);
 
-                    status = U_ZERO_ERROR;
-                    OString aUDName = OString::Concat(rule) + "_" + aLanguage;
-                    UDataMemory* pUData = udata_open("OpenOffice", "brk", aUDName.getStr(), &status);
-                    if( U_SUCCESS(status) )
-                        rbi = std::make_shared<OOoRuleBasedBreakIterator>( pUData, status);
-                    if ( U_SUCCESS(status) )
-                    {
-                        icuBI->mpValue = std::make_shared<BI_ValueData>();
-                        icuBI->mpValue->mpBreakIterator = rbi;
-                        theBIMap.insert( std::make_pair( aBIMapRuleKey, icuBI->mpValue));
+                        if (U_SUCCESS(status))
+                        {
+                            icuBI->mpValue = std::make_shared<BI_ValueData>();
+                            icuBI->mpValue->mpBreakIterator = rbi;
+                            theBIMap.insert( std::make_pair( aBIMapRuleTypeKey, icuBI->mpValue));
+                        }
+                        else
+                        {
+                            rbi.reset();
+                        }
                     }
                     else
                     {
-                        rbi.reset();
-
-                        // ;rule (only)
-                        const OString aBIMapRuleOnlyKey( OString::Concat(";") + rule);
-                        aMapIt = theBIMap.find( aBIMapRuleOnlyKey);
+                        // language;rule (not langtag, unless we'd actually load such)
+                        OString aLanguage( LanguageTag( rLocale).getLanguage().toUtf8());
+                        const OString aBIMapRuleKey( aLanguage + ";" + rule);
+                        aMapIt = theBIMap.find( aBIMapRuleKey);
                         bInMap = (aMapIt != theBIMap.end());
                         if (bInMap)
                         {
@@ -222,74 +220,104 @@ void BreakIterator_Unicode::loadICUBreakIterator(const css::lang::Locale& rLocal
                         }
 
                         status = U_ZERO_ERROR;
-                        pUData = udata_open("OpenOffice", "brk", rule, &status);
+                        OString aUDName = OString::Concat(rule) + "_" + aLanguage;
+                        UDataMemory* pUData = udata_open("OpenOffice", "brk", aUDName.getStr(), &status);
                         if( U_SUCCESS(status) )
                             rbi = std::make_shared<OOoRuleBasedBreakIterator>( pUData, status);
                         if ( U_SUCCESS(status) )
                         {
                             icuBI->mpValue = std::make_shared<BI_ValueData>();
                             icuBI->mpValue->mpBreakIterator = rbi;
-                            theBIMap.insert( std::make_pair( aBIMapRuleOnlyKey, icuBI->mpValue));
+                            theBIMap.insert( std::make_pair( aBIMapRuleKey, icuBI->mpValue));
                         }
                         else
                         {
                             rbi.reset();
+
+                            // ;rule (only)
+                            const OString aBIMapRuleOnlyKey( OString::Concat(";") + rule);
+                            aMapIt = theBIMap.find( aBIMapRuleOnlyKey);
+                            bInMap = (aMapIt != theBIMap.end());
+                            if (bInMap)
+                            {
+                                icuBI->mpValue = aMapIt->second;
+                                icuBI->maBIMapKey = aBIMapGlobalKey;
+                                theBIMap.insert( std::make_pair( aBIMapGlobalKey, icuBI->mpValue));
+                                break;  // do
+                            }
+
+                            status = U_ZERO_ERROR;
+                            pUData = udata_open("OpenOffice", "brk", rule, &status);
+                            if( U_SUCCESS(status) )
+                                rbi = std::make_shared<OOoRuleBasedBreakIterator>( pUData, status);
+                            if ( U_SUCCESS(status) )
+                            {
+                                icuBI->mpValue = std::make_shared<BI_ValueData>();
+                                icuBI->mpValue->mpBreakIterator = rbi;
+                                theBIMap.insert( std::make_pair( aBIMapRuleOnlyKey, icuBI->mpValue));
+                            }
+                            else
+                            {
+                                rbi.reset();
+                            }
                         }
                     }
-                }
-            } while (false);
+                } while (false);
 
-        if (!icuBI->mpValue || !icuBI->mpValue->mpBreakIterator)
-            do
-            {
-                // langtag;;;rBreakType (empty rule; empty breakType)
-                const OString aBIMapLocaleTypeKey( aLangtagStr + ";;;" + OString::number(rBreakType));
-                aMapIt = theBIMap.find( aBIMapLocaleTypeKey);
-                bInMap = (aMapIt != theBIMap.end());
-                if (bInMap)
+            if (!icuBI->mpValue || !icuBI->mpValue->mpBreakIterator)
+                do
                 {
-                    icuBI->mpValue = aMapIt->second;
-                    icuBI->maBIMapKey = aBIMapGlobalKey;
-                    theBIMap.insert( std::make_pair( aBIMapGlobalKey, icuBI->mpValue));
-                    break;  // do
-                }
+                    // langtag;;;rBreakType (empty rule; empty breakType)
+                    const OString aBIMapLocaleTypeKey( aLangtagStr + ";;;" + OString::number(rBreakType));
+                    aMapIt = theBIMap.find( aBIMapLocaleTypeKey);
+                    bInMap = (aMapIt != theBIMap.end());
+                    if (bInMap)
+                    {
+                        icuBI->mpValue = aMapIt->second;
+                        icuBI->maBIMapKey = aBIMapGlobalKey;
+                        theBIMap.insert( std::make_pair( aBIMapGlobalKey, icuBI->mpValue));
+                        break;  // do
+                    }
 
-                icu::Locale icuLocale( LanguageTagIcu::getIcuLocale( LanguageTag( rLocale)));
-                std::shared_ptr< icu::BreakIterator > pBI;
+                    icu::Locale icuLocale( LanguageTagIcu::getIcuLocale( LanguageTag( rLocale)));
+                    std::shared_ptr< icu::BreakIterator > pBI;
 
-                status = U_ZERO_ERROR;
-                switch (rBreakType) {
-                    case LOAD_CHARACTER_BREAKITERATOR:
-                        pBI.reset( icu::BreakIterator::createCharacterInstance(icuLocale, status) );
-                        break;
-                    case LOAD_WORD_BREAKITERATOR:
-                        pBI.reset( icu::BreakIterator::createWordInstance(icuLocale, status) );
-                        break;
-                    case LOAD_SENTENCE_BREAKITERATOR:
-                        pBI.reset( icu::BreakIterator::createSentenceInstance(icuLocale, status) );
-                        break;
-                    case LOAD_LINE_BREAKITERATOR:
-                        pBI.reset( icu::BreakIterator::createLineInstance(icuLocale, status) );
-                        break;
-                }
-                if ( !U_SUCCESS(status) || !pBI ) {
-                    throw uno::RuntimeException("Failed to create ICU BreakIterator: error " + OUString::createFromAscii(u_errorName(status)));
-                }
-                icuBI->mpValue = std::make_shared<BI_ValueData>();
-                icuBI->mpValue->mpBreakIterator = std::move(pBI);
-                theBIMap.insert( std::make_pair( aBIMapLocaleTypeKey, icuBI->mpValue));
-            } while (false);
-        if (!icuBI->mpValue || !icuBI->mpValue->mpBreakIterator) {
-            throw uno::RuntimeException(u"ICU BreakIterator is not properly initialized"_ustr);
+                    status = U_ZERO_ERROR;
+                    switch (rBreakType) {
+                        case LOAD_CHARACTER_BREAKITERATOR:
+                            pBI.reset( icu::BreakIterator::createCharacterInstance(icuLocale, status) );
+                            break;
+                        case LOAD_WORD_BREAKITERATOR:
+                            pBI.reset( icu::BreakIterator::createWordInstance(icuLocale, status) );
+                            break;
+                        case LOAD_SENTENCE_BREAKITERATOR:
+                            pBI.reset( icu::BreakIterator::createSentenceInstance(icuLocale, status) );
+                            break;
+                        case LOAD_LINE_BREAKITERATOR:
+                            pBI.reset( icu::BreakIterator::createLineInstance(icuLocale, status) );
+                            break;
+                    }
+                    if ( !U_SUCCESS(status) || !pBI ) {
+                        throw uno::RuntimeException("Failed to create ICU BreakIterator: error " + OUString::createFromAscii(u_errorName(status)));
+                    }
+                    icuBI->mpValue = std::make_shared<BI_ValueData>();
+                    icuBI->mpValue->mpBreakIterator = std::move(pBI);
+                    theBIMap.insert( std::make_pair( aBIMapLocaleTypeKey, icuBI->mpValue));
+                } while (false);
+            if (!icuBI->mpValue || !icuBI->mpValue->mpBreakIterator) {
+                throw uno::RuntimeException(u"ICU BreakIterator is not properly initialized"_ustr);
+            }
+            icuBI->maBIMapKey = aBIMapGlobalKey;
+            if (!bInMap)
+                theBIMap.insert( std::make_pair( aBIMapGlobalKey, icuBI->mpValue));
+            bNewBreak=true;
         }
-        icuBI->maBIMapKey = aBIMapGlobalKey;
-        if (!bInMap)
-            theBIMap.insert( std::make_pair( aBIMapGlobalKey, icuBI->mpValue));
-        bNewBreak=true;
+        icuBI->maLocale = rLocale;
+        icuBI->mpRule = pRequestedRule;
     }
 
     if (!(bNewBreak || icuBI->mpValue->maICUText.pData != rText.pData))
-        return;
+        return icuBI->mpValue->mpBreakIterator.get();
 
     const UChar *pText = reinterpret_cast<const UChar *>(rText.getStr());
 
@@ -305,6 +333,7 @@ void BreakIterator_Unicode::loadICUBreakIterator(const css::lang::Locale& rLocal
         throw uno::RuntimeException("Failed to set text for ICU BreakIterator: error " + OUString::createFromAscii(u_errorName(status)));
 
     icuBI->mpValue->maICUText = rText;
+    return icuBI->mpValue->mpBreakIterator.get();
 }
 
 sal_Int32 SAL_CALL BreakIterator_Unicode::nextCharacters( const OUString& Text,
@@ -312,8 +341,7 @@ sal_Int32 SAL_CALL BreakIterator_Unicode::nextCharacters( const OUString& Text,
         sal_Int16 nCharacterIteratorMode, sal_Int32 nCount, sal_Int32& nDone )
 {
     if (nCharacterIteratorMode == CharacterIteratorMode::SKIPCELL ) { // for CELL mode
-        loadICUBreakIterator(rLocale, LOAD_CHARACTER_BREAKITERATOR, 0, "char", Text);
-        icu::BreakIterator* pBI = character.mpValue->mpBreakIterator.get();
+        icu::BreakIterator* pBI = loadICUBreakIterator(rLocale, LOAD_CHARACTER_BREAKITERATOR, 0, "char", Text);
         for (nDone = 0; nDone < nCount; nDone++) {
             nStartPos = pBI->following(nStartPos);
             if (nStartPos == icu::BreakIterator::DONE)
@@ -331,8 +359,7 @@ sal_Int32 SAL_CALL BreakIterator_Unicode::previousCharacters( const OUString& Te
         sal_Int16 nCharacterIteratorMode, sal_Int32 nCount, sal_Int32& nDone )
 {
     if (nCharacterIteratorMode == CharacterIteratorMode::SKIPCELL ) { // for CELL mode
-        loadICUBreakIterator(rLocale, LOAD_CHARACTER_BREAKITERATOR, 0, "char", Text);
-        icu::BreakIterator* pBI = character.mpValue->mpBreakIterator.get();
+        icu::BreakIterator* pBI = loadICUBreakIterator(rLocale, LOAD_CHARACTER_BREAKITERATOR, 0, "char", Text);
         for (nDone = 0; nDone < nCount; nDone++) {
             nStartPos = pBI->preceding(nStartPos);
             if (nStartPos == icu::BreakIterator::DONE)
@@ -349,10 +376,10 @@ sal_Int32 SAL_CALL BreakIterator_Unicode::previousCharacters( const OUString& Te
 Boundary SAL_CALL BreakIterator_Unicode::nextWord( const OUString& Text, sal_Int32 nStartPos,
     const lang::Locale& rLocale, sal_Int16 rWordType )
 {
-    loadICUBreakIterator(rLocale, LOAD_WORD_BREAKITERATOR, rWordType, nullptr, Text);
+    icu::BreakIterator* pBI = loadICUBreakIterator(rLocale, LOAD_WORD_BREAKITERATOR, rWordType, nullptr, Text);
 
     Boundary rv;
-    rv.startPos = icuBI->mpValue->mpBreakIterator->following(nStartPos);
+    rv.startPos = pBI->following(nStartPos);
     if( rv.startPos >= Text.getLength() || rv.startPos == icu::BreakIterator::DONE )
         rv.endPos = rv.startPos;
     else {
@@ -360,9 +387,9 @@ Boundary SAL_CALL BreakIterator_Unicode::nextWord( const OUString& Text, sal_Int
              && u_isUWhiteSpace(Text.iterateCodePoints(&rv.startPos, 0)))
             || (rWordType == WordType::DICTIONARY_WORD
                 && u_isWhitespace(Text.iterateCodePoints(&rv.startPos, 0))))
-            rv.startPos = icuBI->mpValue->mpBreakIterator->following(rv.startPos);
+            rv.startPos = pBI->following(rv.startPos);
 
-        rv.endPos = icuBI->mpValue->mpBreakIterator->following(rv.startPos);
+        rv.endPos = pBI->following(rv.startPos);
         if(rv.endPos == icu::BreakIterator::DONE)
             rv.endPos = rv.startPos;
     }
@@ -373,10 +400,10 @@ Boundary SAL_CALL BreakIterator_Unicode::nextWord( const OUString& Text, sal_Int
 Boundary SAL_CALL BreakIterator_Unicode::previousWord(const OUString& Text, sal_Int32 nStartPos,
         const lang::Locale& rLocale, sal_Int16 rWordType)
 {
-    loadICUBreakIterator(rLocale, LOAD_WORD_BREAKITERATOR, rWordType, nullptr, Text);
+    icu::BreakIterator* pBI = loadICUBreakIterator(rLocale, LOAD_WORD_BREAKITERATOR, rWordType, nullptr, Text);
 
     Boundary rv;
-    rv.startPos = icuBI->mpValue->mpBreakIterator->preceding(nStartPos);
+    rv.startPos = pBI->preceding(nStartPos);
     if( rv.startPos < 0)
         rv.endPos = rv.startPos;
     else {
@@ -385,9 +412,9 @@ Boundary SAL_CALL BreakIterator_Unicode::previousWord(const OUString& Text, sal_
              && u_isUWhiteSpace(Text.iterateCodePoints(&rv.startPos, 0)))
             || (rWordType == WordType::DICTIONARY_WORD
                 && u_isWhitespace(Text.iterateCodePoints(&rv.startPos, 0))))
-            rv.startPos = icuBI->mpValue->mpBreakIterator->preceding(rv.startPos);
+            rv.startPos = pBI->preceding(rv.startPos);
 
-        rv.endPos = icuBI->mpValue->mpBreakIterator->following(rv.startPos);
+        rv.endPos = pBI->following(rv.startPos);
         if(rv.endPos == icu::BreakIterator::DONE)
             rv.endPos = rv.startPos;
     }
@@ -398,26 +425,26 @@ Boundary SAL_CALL BreakIterator_Unicode::previousWord(const OUString& Text, sal_
 Boundary SAL_CALL BreakIterator_Unicode::getWordBoundary( const OUString& Text, sal_Int32 nPos, const lang::Locale& rLocale,
         sal_Int16 rWordType, sal_Bool bDirection )
 {
-    loadICUBreakIterator(rLocale, LOAD_WORD_BREAKITERATOR, rWordType, nullptr, Text);
+    icu::BreakIterator* pBI = loadICUBreakIterator(rLocale, LOAD_WORD_BREAKITERATOR, rWordType, nullptr, Text);
     sal_Int32 len = Text.getLength();
 
     Boundary rv;
-    if(icuBI->mpValue->mpBreakIterator->isBoundary(nPos)) {
+    if(pBI->isBoundary(nPos)) {
         rv.startPos = rv.endPos = nPos;
         if((bDirection || nPos == 0) && nPos < len) //forward
-            rv.endPos = icuBI->mpValue->mpBreakIterator->following(nPos);
+            rv.endPos = pBI->following(nPos);
         else
-            rv.startPos = icuBI->mpValue->mpBreakIterator->preceding(nPos);
+            rv.startPos = pBI->preceding(nPos);
     } else {
         if(nPos <= 0) {
             rv.startPos = 0;
-            rv.endPos = len ? icuBI->mpValue->mpBreakIterator->following(sal_Int32(0)) : 0;
+            rv.endPos = len ? pBI->following(sal_Int32(0)) : 0;
         } else if(nPos >= len) {
-            rv.startPos = icuBI->mpValue->mpBreakIterator->preceding(len);
+            rv.startPos = pBI->preceding(len);
             rv.endPos = len;
         } else {
-            rv.startPos = icuBI->mpValue->mpBreakIterator->preceding(nPos);
-            rv.endPos = icuBI->mpValue->mpBreakIterator->following(nPos);
+            rv.startPos = pBI->preceding(nPos);
+            rv.endPos = pBI->following(nPos);
         }
     }
     if (rv.startPos == icu::BreakIterator::DONE)
@@ -432,13 +459,13 @@ Boundary SAL_CALL BreakIterator_Unicode::getWordBoundary( const OUString& Text,
 sal_Int32 SAL_CALL BreakIterator_Unicode::beginOfSentence( const OUString& Text, sal_Int32 nStartPos,
         const lang::Locale &rLocale )
 {
-    loadICUBreakIterator(rLocale, LOAD_SENTENCE_BREAKITERATOR, 0, "sent", Text);
+    icu::BreakIterator* pBI = loadICUBreakIterator(rLocale, LOAD_SENTENCE_BREAKITERATOR, 0, "sent", Text);
 
     sal_Int32 len = Text.getLength();
     if (len > 0 && nStartPos == len)
         Text.iterateCodePoints(&nStartPos, -1); // issue #i27703# treat end position as part of last sentence
-    if (!sentence.mpValue->mpBreakIterator->isBoundary(nStartPos))
-        nStartPos = sentence.mpValue->mpBreakIterator->preceding(nStartPos);
+    if (!pBI->isBoundary(nStartPos))
+        nStartPos = pBI->preceding(nStartPos);
 
     // skip preceding space.
     sal_uInt32 ch = Text.iterateCodePoints(&nStartPos);
@@ -451,12 +478,12 @@ sal_Int32 SAL_CALL BreakIterator_Unicode::beginOfSentence( const OUString& Text,
 sal_Int32 SAL_CALL BreakIterator_Unicode::endOfSentence( const OUString& Text, sal_Int32 nStartPos,
         const lang::Locale &rLocale )
 {
-    loadICUBreakIterator(rLocale, LOAD_SENTENCE_BREAKITERATOR, 0, "sent", Text);
+    icu::BreakIterator* pBI = loadICUBreakIterator(rLocale, LOAD_SENTENCE_BREAKITERATOR, 0, "sent", Text);
 
     sal_Int32 len = Text.getLength();
     if (len > 0 && nStartPos == len)
         Text.iterateCodePoints(&nStartPos, -1); // issue #i27703# treat end position as part of last sentence
-    nStartPos = sentence.mpValue->mpBreakIterator->following(nStartPos);
+    nStartPos = pBI->following(nStartPos);
 
     sal_Int32 nPos=nStartPos;
     while (nPos > 0 && u_isWhitespace(Text.iterateCodePoints(&nPos, -1))) nStartPos=nPos;
@@ -478,9 +505,7 @@ LineBreakResults SAL_CALL BreakIterator_Unicode::getLineBreak(
         return lbr;
     }
 
-    loadICUBreakIterator(rLocale, LOAD_LINE_BREAKITERATOR, 0, lineRule, Text);
-
-    icu::BreakIterator* pLineBI = line.mpValue->mpBreakIterator.get();
+    icu::BreakIterator* pLineBI = loadICUBreakIterator(rLocale, LOAD_LINE_BREAKITERATOR, 0, lineRule, Text);
     bool GlueSpace=true;
     while (GlueSpace) {
         // don't break with Slash U+002F SOLIDUS at end of line; see "else" below!
@@ -162,7 +162,11 @@ TMList const TMlist[] = {                //      Modules      ModulesNew
 };
 
 // Constructor/Destructor
-TransliterationImpl::TransliterationImpl(const Reference <XComponentContext>& xContext) : mxContext(xContext)
+TransliterationImpl::TransliterationImpl(const Reference <XComponentContext>& xContext)
+    : mxContext(xContext)
+    , maLatin1Map()
+    , meLatin1MapState(Latin1MapState::Unknown)
+    , maCache(256)
 {
     numCascade = 0;
     caseignoreOnly = true;
@@ -312,6 +316,104 @@ TransliterationImpl::getAvailableModules( const Locale& rLocale, sal_Int16 sType
 }
 
 
+/// Modules that map every char on its own, whatever precedes or follows it
+static bool lcl_isContextFree(const Reference<XExtendedTransliteration>& xBody)
+{
+    static constexpr std::u16string_view aContextFree[] = {
+        u"UPPERCASE_LOWERCASE",
+        u"LOWERCASE_UPPERCASE",
+        u"IGNORE_CASE",
+        u"IGNORE_WIDTH",
+        u"IGNORE_KANA",
+        u"FULLWIDTH_HALFWIDTH",
+        u"HALFWIDTH_FULLWIDTH",
+        u"FULLWIDTH_HALFWIDTH_LIKE_ASC",
+        u"HALFWIDTH_FULLWIDTH_LIKE_JIS",
+        u"FULLWIDTHKATAKANA_HALFWIDTHKATAKANA",
+        u"HALFWIDTHKATAKANA_FULLWIDTHKATAKANA",
+        u"HIRAGANA_KATAKANA",
+        u"KATAKANA_HIRAGANA",
+    };
+
+    Reference<XServiceInfo> xInfo(xBody, UNO_QUERY);
+    if (!xInfo.is())
+        return false;
+    const OUString aImplName(xInfo->getImplementationName());
+    std::u16string_view aName;
+    if (!o3tl::starts_with(aImplName, u"" TRLT_IMPLNAME_PREFIX, &aName))
+        return false;
+    return std::find(std::begin(aContextFree), std::end(aContextFree), aName)
+           != std::end(aContextFree);
+}
+
+const std::array<sal_Unicode, 256>* TransliterationImpl::getLatin1Map()
+{
+    Latin1MapState eState = meLatin1MapState.load(std::memory_order_acquire);
+    if (eState == Latin1MapState::Unknown)
+    {
+        std::scoped_lock aGuard(maCacheMutex);
+        eState = meLatin1MapState.load(std::memory_order_relaxed);
+        if (eState == Latin1MapState::Unknown)
+        {
+            // Only cascades of modules that map char by char can be fused into
+            // a table; title, sentence and toggle case, numeric modules and the
+            // like depend on the neighbouring chars.
+            eState = Latin1MapState::Valid;
+            for (sal_Int32 i = 0; i < numCascade; i++)
+                if (!bodyCascade[i].is() || !lcl_isContextFree(bodyCascade[i]))
+                    eState = Latin1MapState::Unusable;
+
+            Sequence<sal_Int32> aOffset;
+            for (sal_Int32 c = 0; eState == Latin1MapState::Valid && c < 256; c++)
+            {
+                const sal_Unicode cIn(c);
+                try
+                {
+                    const OUString aOut(transliterateCascade(OUString(&cIn, 1), 0, 1, aOffset));
+                    maLatin1Map[c] = aOut.getLength() == 1 ? aOut[0] : LATIN1_COMPLEX;
+                }
+                catch (const RuntimeException&)
+                {
+                    maLatin1Map[c] = LATIN1_COMPLEX;
+                }
+            }
+            meLatin1MapState.store(eState, std::memory_order_release);
+        }
+    }
+    return eState == Latin1MapState::Valid ? &maLatin1Map : nullptr;
+}
+
+bool TransliterationImpl::transliterateLatin1( const OUString& inStr, sal_Int32 startPos,
+        sal_Int32 nCount, Sequence< sal_Int32 >& offset, OUString& rResult )
+{
+    if (startPos < 0 || nCount <= 0 || nCount > inStr.getLength() - startPos)
+        return false;
+
+    const std::array<sal_Unicode, 256>* pMap = getLatin1Map();
+    if (!pMap)
+        return false;
+
+    rtl_uString* pNew = rtl_uString_alloc(nCount);
+    const sal_Unicode* pSrc = inStr.getStr() + startPos;
+    for (sal_Int32 i = 0; i < nCount; i++)
+    {
+        const sal_Unicode c = pSrc[i];
+        if (c > 0xFF || (*pMap)[c] == LATIN1_COMPLEX)
+        {
+            rtl_uString_release(pNew);
+            return false;
+        }
+        pNew->buffer[i] = (*pMap)[c];
+    }
+    rResult = OUString(pNew, SAL_NO_ACQUIRE);
+
+    // same as the cascade would report for a one to one mapping
+    offset.realloc(nCount);
+    auto [begin, end] = asNonConstRange(offset);
+    std::iota(begin, end, startPos);
+    return true;
+}
+
 OUString SAL_CALL
 TransliterationImpl::transliterate( const OUString& inStr, sal_Int32 startPos, sal_Int32 nCount,
                     Sequence< sal_Int32 >& offset )
@@ -319,6 +421,36 @@ TransliterationImpl::transliterate( const OUString& inStr, sal_Int32 startPos, s
     if (numCascade == 0)
         return inStr;
 
+    OUString aResult;
+    if (transliterateLatin1(inStr, startPos, nCount, offset, aResult))
+        return aResult;
+
+    const bool bWholeString = startPos == 0 && nCount == inStr.getLength();
+    if (bWholeString)
+    {
+        std::scoped_lock aGuard(maCacheMutex);
+        auto aHit = maCache.find(inStr);
+        if (aHit != maCache.end())
+        {
+            offset = aHit->second.second;
+            return aHit->second.first;
+        }
+    }
+
+    aResult = transliterateCascade(inStr, startPos, nCount, offset);
+
+    if (bWholeString)
+    {
+        std::scoped_lock aGuard(maCacheMutex);
+        maCache.insert({ inStr, { aResult, offset } });
+    }
+    return aResult;
+}
+
+OUString
+TransliterationImpl::transliterateCascade( const OUString& inStr, sal_Int32 startPos, sal_Int32 nCount,
+                    Sequence< sal_Int32 >& offset )
+{
     if (numCascade == 1)
     {
         if ( startPos == 0 && nCount == inStr.getLength() )
@@ -595,6 +727,10 @@ TransliterationImpl::clear()
     numCascade = 0;
     caseignore.clear();
     caseignoreOnly = true;
+
+    std::scoped_lock aGuard(maCacheMutex);
+    maCache.clear();
+    meLatin1MapState.store(Latin1MapState::Unknown, std::memory_order_release);
 }
 
 namespace
@@ -26,6 +26,7 @@
 #include <svl/typedwhich.hxx>
 #include <svl/whichranges.hxx>
 #include <memory>
+#include <mutex>
 #include <vector>
 #include <unordered_set>
 #include <unordered_map>
@@ -118,9 +119,12 @@ protected:
     static void setItemAtItemInfoStatic(SfxPoolItem* pItem, ItemInfoStatic& rItemInfo) { rItemInfo.setItem(pItem); }
 
 private:
-    // mechanism for buffered SlotIDToWhichIDMap
+    // mechanism for buffered SlotIDToWhichIDMap. The Package is usually a
+    // static shared by all Pools of a kind, so the buffer is filled exactly
+    // once under maSlotIDToWhichIDMapOnce
     virtual const ItemInfoStatic& getItemInfoStatic(size_t nIndex) const = 0;
     mutable SlotIDToWhichIDMap maSlotIDToWhichIDMap;
+    mutable std::once_flag maSlotIDToWhichIDMapOnce;
 
 public:
     ItemInfoPackage() = default;
@@ -147,6 +151,15 @@ typedef std::unordered_map<SfxItemType, NameOrIndexContent> registeredNameOrInde
  * (usually within a single document).
  * This helps to lower the amount of calls to lifecycle methods, speeds up comparisons within a document
  * and facilitates loading and saving of attributes.
+ *
+ * Threading: once a Pool is set up (ItemInfoPackage registered, secondary Pools attached) the
+ * read-only accessors - GetPoolDefaultItem, GetUserOrPoolDefaultItem, GetMergedIdRanges,
+ * GetWhichIDFromSlotID and friends - do not modify the Pool and may be called concurrently from
+ * worker threads, as may SfxItemSet::Get/GetItemState on sets nobody modifies meanwhile.
+ * That is all: copying a set or putting Items may clone Items and look them up in the global,
+ * unsynchronized ItemInstanceManager registry, so that - like anything else that creates or
+ * releases Items, iterates Item surrogates or changes the Pool (user defaults, secondary
+ * Pools) - still requires the SolarMutex.
  */
 class SVL_DLLPUBLIC SfxItemPool : public salhelper::SimpleReferenceObject
 {
@@ -162,7 +175,7 @@ class SVL_DLLPUBLIC SfxItemPool : public salhelper::SimpleReferenceObject
     OUString                        aName;
     SfxItemPool*                    mpMaster;
     rtl::Reference<SfxItemPool>     mpSecondary;
-    mutable WhichRangesContainer    maPoolRanges;
+    WhichRangesContainer            maPoolRanges;
     sal_uInt16                      mnStart;
     sal_uInt16                      mnEnd;
     MapUnit                         eDefMetric;
@@ -174,6 +187,10 @@ class SVL_DLLPUBLIC SfxItemPool : public salhelper::SimpleReferenceObject
     // SfxItemSet or SfxPolItemHolder for this Model/Pool
     registeredNameOrIndex maRegisteredNameOrIndex;
 
+    // guards the three registration containers above, used at the master Pool.
+    // Recursive since registering a SfxPoolItemHolder also registers its Item
+    std::recursive_mutex maRegistrationMutex;
+
     bool mbShutdownHintSent;
 
     itemInfoVector maItemInfos;
@@ -190,6 +207,7 @@ protected:
     void impCreateUserDefault(const SfxPoolItem& rItem);
 private:
     void cleanupItemInfos();
+    void impUpdateMergedIdRanges();
 
 private:
     sal_uInt16 GetIndex_Impl(sal_uInt16 nWhich) const
@@ -217,8 +235,9 @@ private:
     void unregisterNameOrIndex(const SfxPoolItem& rItem);
 
 public:
-    // for default SfxItemSet::CTOR, set default WhichRanges
-    const WhichRangesContainer& GetMergedIdRanges() const;
+    // for default SfxItemSet::CTOR, set default WhichRanges. Kept up to
+    // date whenever the Pool chain changes, so this is a pure read
+    const WhichRangesContainer& GetMergedIdRanges() const { return maPoolRanges; }
 
 protected:
     static inline void              AddRef(const SfxPoolItem& rItem);
@@ -35,6 +35,7 @@ class Color;
 class ImpSvNumberformatScan;
 class ImpSvNumberInputScan;
 class SvNumberFormatter;
+class PlainDecimalFastPathTest;
 
 class SVL_DLLPUBLIC SvNFLanguageData
 {
@@ -129,10 +130,14 @@ public:
 
     sal_uInt16 ExpandTwoDigitYear(sal_uInt16 nYear) const;
 
+    /// Whether plain 0[.0...] decimals may bypass the general input scanner and output formatting
+    bool IsPlainDecimalFastPath() const { return bPlainDecimalFastPath; }
+
 private:
     friend class SvNFEngine;
     friend class SvNFFormatData;
     friend class SvNumberFormatter;
+    friend class ::PlainDecimalFastPathTest;
 
     css::uno::Reference<css::uno::XComponentContext> xContext;
 
@@ -153,6 +158,7 @@ private:
     OUString aDateSep;
 
     NfEvalDateFormat eEvalDateFormat; // DateFormat evaluation
+    bool bPlainDecimalFastPath; // only switched off by unit tests comparing against the general paths
 };
 
 class SVL_DLLPUBLIC SvNFFormatData
@@ -24,10 +24,12 @@
 
 class SvNumberFormatterRegistry_Impl;
 class NfCurrencyTable;
+class PlainDecimalFastPathTest;
 
 class SVL_DLLPUBLIC SvNumberFormatter
 {
     friend class SvNumberFormatterRegistry_Impl;
+    friend class ::PlainDecimalFastPathTest;
 
 public:
     /**
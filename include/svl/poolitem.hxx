@@ -22,6 +22,7 @@
 
 #include <sal/config.h>
 
+#include <atomic>
 #include <memory>
 #include <vector>
 
@@ -583,7 +584,9 @@ class SVL_DLLPUBLIC SfxPoolItem
     friend SfxPoolItem const* implCreateItemEntry(const SfxItemPool&, SfxPoolItem const*, bool);
     friend void implCleanupItemEntry(SfxPoolItem const*);
 
-    mutable sal_uInt32 m_nRefCount;
+    // atomic so that references to an Item shared by SfxItemSets on
+    // different threads are never miscounted
+    mutable std::atomic<sal_uInt32> m_nRefCount;
     sal_uInt16  m_nWhich;
 
 #ifdef DBG_UTIL
@@ -642,8 +645,8 @@ protected:
 public:
     inline void AddRef(sal_uInt32 n = 1) const
     {
-        assert(n <= SFX_ITEMS_MAXREF - m_nRefCount && "AddRef: refcount overflow");
-        m_nRefCount += n;
+        assert(n <= SFX_ITEMS_MAXREF - m_nRefCount.load(std::memory_order_relaxed) && "AddRef: refcount overflow");
+        m_nRefCount.fetch_add(n, std::memory_order_relaxed);
     }
 
 #ifdef DBG_UTIL
@@ -667,9 +670,9 @@ public:
 private:
     inline sal_uInt32 ReleaseRef(sal_uInt32 n = 1) const
     {
-        assert(n <= m_nRefCount);
-        m_nRefCount -= n;
-        return m_nRefCount;
+        const sal_uInt32 nOld(m_nRefCount.fetch_sub(n, std::memory_order_acq_rel));
+        assert(n <= nOld);
+        return nOld - n;
     }
 
 protected:
@@ -752,7 +755,7 @@ public:
         return std::unique_ptr<T>(static_cast<T*>(CloneSetWhich(sal_uInt16(nId)).release()));
     }
 
-    sal_uInt32               GetRefCount() const { return m_nRefCount; }
+    sal_uInt32               GetRefCount() const { return m_nRefCount.load(std::memory_order_acquire); }
     virtual void dumpAsXml(xmlTextWriterPtr pWriter) const;
     virtual boost::property_tree::ptree dumpAsJSON() const;
 
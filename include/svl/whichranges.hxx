@@ -12,6 +12,7 @@
 #include <sal/types.h>
 #include <svl/svldllapi.h>
 #include <array>
+#include <atomic>
 #include <memory>
 #include <cassert>
 
@@ -71,8 +72,6 @@ template <sal_uInt16... WIDs> struct Items_t
 template <sal_uInt16... WIDs> inline static constexpr auto Items = Items_t<WIDs...>{};
 }
 
-#define INVALID_WHICHPAIR_OFFSET (sal_uInt16(0xffff))
-
 /**
  * Most of the time, the which ranges we point at are a compile-time literal.
  * So we take advantage of that, and avoid the cost of allocating our own array and copying into it.
@@ -85,11 +84,10 @@ class SVL_DLLPUBLIC WhichRangesContainer
     sal_Int32 m_size = 0;
     mutable sal_uInt16 m_TotalCount = 0;
 
-    // variables for buffering the last used WhichPair to allow fast answers
-    // in doesContainWhich
-    mutable sal_uInt16 m_aLastWhichPairOffset = INVALID_WHICHPAIR_OFFSET;
-    mutable sal_uInt16 m_aLastWhichPairFirst = 0;
-    mutable sal_uInt16 m_aLastWhichPairSecond = 0;
+    // buffers the last used WhichPair to allow fast answers in doesContainWhich,
+    // packed as (first << 16 | second), 0 if none. A single relaxed atomic so that
+    // concurrent readers of a shared SfxItemSet never see a torn pair
+    mutable std::atomic<sal_uInt32> m_nLastWhichPair = 0;
 
     /** if true, we allocated and need to delete the pairs, if not, we are pointing
       * at a global const literal */
@@ -124,9 +122,7 @@ public:
         : m_pairs(wids.release())
         , m_size(nSize)
         , m_TotalCount(0)
-        , m_aLastWhichPairOffset(INVALID_WHICHPAIR_OFFSET)
-        , m_aLastWhichPairFirst(0)
-        , m_aLastWhichPairSecond(0)
+        , m_nLastWhichPair(0)
         , m_bOwnRanges(true)
     {
         CountRanges();
@@ -136,9 +132,7 @@ public:
         : m_pairs(svl::Items_t<WIDs...>::value.data())
         , m_size(svl::Items_t<WIDs...>::value.size())
         , m_TotalCount(0)
-        , m_aLastWhichPairOffset(INVALID_WHICHPAIR_OFFSET)
-        , m_aLastWhichPairFirst(0)
-        , m_aLastWhichPairSecond(0)
+        , m_nLastWhichPair(0)
         , m_bOwnRanges(false)
     {
         CountRanges();
@@ -521,9 +521,17 @@ private:
     bool bAdditionalBuiltin;        // If this is an additional built-in format defined by i18n
     bool bStandard;                 // If this is a default standard format
     bool bIsUsed;                   // Flag as used for storing
+    sal_Int16 mnPlainDecimals;      // Count of decimals if a plain 0[.0...] number format, else -1
 
     SVL_DLLPRIVATE sal_uInt16 ImpGetNumForStringElementCount( sal_uInt16 nNumFor ) const;
 
+    // Determine mnPlainDecimals once the subformats are set up.
+    SVL_DLLPRIVATE void ImpInitPlainDecimals();
+
+    // Fast path of GetOutputString() for plain 0[.0...] number formats,
+    // returns false if the value needs the general ImpGetNumberOutput().
+    SVL_DLLPRIVATE bool ImpGetPlainDecimalOutput( double fNumber, OUString& rOutString ) const;
+
 #ifdef THE_FUTURE
     SVL_DLLPRIVATE bool ImpSwitchToSpecifiedCalendar( OUString& rOrgCalendar,
                                                       double& fOrgDateTime,
@@ -237,6 +237,16 @@ public:
     SvStream&       ReadDouble( double& rDouble );
     SvStream&       ReadStream( SvStream& rStream );
 
+    /** Read nCount numbers with a single ReadBytes() and endian-convert them in place.
+
+        @return the number of complete numbers read; on a short read the remainder of pData
+                is unspecified and eof() is set
+    */
+    std::size_t     ReadNumbers( sal_Int16* pData, std::size_t nCount );
+    std::size_t     ReadNumbers( sal_uInt16* pData, std::size_t nCount );
+    std::size_t     ReadNumbers( sal_Int32* pData, std::size_t nCount );
+    std::size_t     ReadNumbers( sal_uInt32* pData, std::size_t nCount );
+
     SvStream&       WriteUInt16( sal_uInt16 nUInt16 );
     SvStream&       WriteUInt32( sal_uInt32 nUInt32 );
     SvStream&       WriteUInt64( sal_uInt64 nuInt64 );
@@ -411,6 +421,7 @@ public:
 
 private:
     template <typename T> SvStream& ReadNumber(T& r);
+    template <typename T> std::size_t ReadNumberArray(T* pData, std::size_t nCount);
     template <typename T> SvStream& WriteNumber(T n);
 
     template<typename T>
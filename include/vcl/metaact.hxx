@@ -1535,6 +1535,8 @@ private:
 public:
     SAL_DLLPRIVATE explicit            MetaCommentAction( const MetaCommentAction& rAct );
     explicit            MetaCommentAction( OString aComment, sal_Int32 nValue = 0, const sal_uInt8* pData = nullptr, sal_uInt32 nDataSize = 0 );
+    /// takes over pData instead of copying it, for callers that fill a fresh buffer anyway
+                        MetaCommentAction( OString aComment, sal_Int32 nValue, std::unique_ptr<sal_uInt8[]> pData, sal_uInt32 nDataSize );
 
     SAL_DLLPRIVATE virtual void        Move( tools::Long nHorzMove, tools::Long nVertMove ) override;
     SAL_DLLPRIVATE virtual void        Scale( double fScaleX, double fScaleY ) override;
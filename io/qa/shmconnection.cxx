@@ -0,0 +1,197 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+/*
+ * This file is part of the LibreOffice project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <sal/config.h>
+
+#include <com/sun/star/connection/Acceptor.hpp>
+#include <com/sun/star/connection/Connector.hpp>
+#include <com/sun/star/connection/NoConnectException.hpp>
+#include <com/sun/star/connection/XConnection.hpp>
+#include <com/sun/star/io/IOException.hpp>
+#include <com/sun/star/uno/Sequence.hxx>
+#include <com/sun/star/uno/Reference.hxx>
+#include <cppunit/TestAssert.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/plugin/TestPlugIn.h>
+#include <osl/pipe.hxx>
+#include <osl/process.h>
+#include <osl/security.hxx>
+#include <rtl/ustring.hxx>
+#include <sal/types.h>
+#include <unotest/bootstrapfixturebase.hxx>
+
+#include <chrono>
+#include <thread>
+
+namespace {
+
+#if defined LINUX
+
+class Test: public test::BootstrapFixtureBase {
+private:
+    CPPUNIT_TEST_SUITE(Test);
+    CPPUNIT_TEST(testWrapAround);
+    CPPUNIT_TEST(testPeerClosed);
+    CPPUNIT_TEST(testStopAcceptingDuringHandshake);
+    CPPUNIT_TEST_SUITE_END();
+
+    void testWrapAround();
+    void testPeerClosed();
+    void testStopAcceptingDuringHandshake();
+
+    OUString pipeName(std::u16string_view rTest);
+    void connect(const OUString& rDescription,
+                 css::uno::Reference<css::connection::XConnection>& rAccepted,
+                 css::uno::Reference<css::connection::XConnection>& rConnected);
+};
+
+css::uno::Sequence<sal_Int8> makeData(sal_Int32 nSize, sal_Int32 nSeed)
+{
+    css::uno::Sequence<sal_Int8> aData(nSize);
+    sal_Int8* p = aData.getArray();
+    for (sal_Int32 i = 0; i < nSize; ++i)
+        p[i] = static_cast<sal_Int8>(i * 7 + nSeed);
+    return aData;
+}
+
+OUString Test::pipeName(std::u16string_view rTest)
+{
+    oslProcessInfo aInfo;
+    aInfo.Size = sizeof(aInfo);
+    osl_getProcessInfo(nullptr, osl_Process_IDENTIFIER, &aInfo);
+    return OUString::Concat(u"lo_shm_test_") + rTest + "_" + OUString::number(aInfo.Ident);
+}
+
+void Test::connect(const OUString& rDescription,
+                   css::uno::Reference<css::connection::XConnection>& rAccepted,
+                   css::uno::Reference<css::connection::XConnection>& rConnected)
+{
+    css::uno::Reference<css::connection::XAcceptor> xAcceptor(
+        css::connection::Acceptor::create(getComponentContext()));
+    std::thread aAccept([&] { rAccepted = xAcceptor->accept(rDescription); });
+    // the acceptor may not have created its pipe yet
+    for (int i = 0; !rConnected.is(); ++i)
+    {
+        try
+        {
+            rConnected = css::connection::Connector::create(getComponentContext())
+                             ->connect(rDescription);
+        }
+        catch (const css::connection::NoConnectException&)
+        {
+            if (i == 100)
+                throw;
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        }
+    }
+    aAccept.join();
+    xAcceptor->stopAccepting();
+    CPPUNIT_ASSERT(rAccepted.is());
+}
+
+void Test::testWrapAround()
+{
+    // smallest possible ring, so that a few kilobytes already wrap around several times
+    css::uno::Reference<css::connection::XConnection> xAccepted, xConnected;
+    connect("shm,name=" + pipeName(u"wrap") + ",size=4096", xAccepted, xConnected);
+
+    css::uno::Sequence<sal_Int8> aRead;
+    for (sal_Int32 nSeed = 0; nSeed < 5; ++nSeed)
+    {
+        // 3000 bytes never fit twice, so every second chunk is split at the end of the ring
+        const css::uno::Sequence<sal_Int8> aData(makeData(3000, nSeed));
+        xConnected->write(aData);
+        CPPUNIT_ASSERT_EQUAL(sal_Int32(3000), xAccepted->read(aRead, 3000));
+        CPPUNIT_ASSERT(aData == aRead);
+
+        xAccepted->write(aData);
+        CPPUNIT_ASSERT_EQUAL(sal_Int32(3000), xConnected->read(aRead, 3000));
+        CPPUNIT_ASSERT(aData == aRead);
+    }
+
+    // more than the whole ring at once: the writer has to wait for the reader
+    const css::uno::Sequence<sal_Int8> aLarge(makeData(100000, 42));
+    std::thread aWriter([&] { xConnected->write(aLarge); });
+    CPPUNIT_ASSERT_EQUAL(sal_Int32(100000), xAccepted->read(aRead, 100000));
+    aWriter.join();
+    CPPUNIT_ASSERT(aLarge == aRead);
+
+    xConnected->close();
+    xAccepted->close();
+}
+
+void Test::testPeerClosed()
+{
+    css::uno::Reference<css::connection::XConnection> xAccepted, xConnected;
+    connect("shm,name=" + pipeName(u"closed") + ",size=4096", xAccepted, xConnected);
+
+    // what was written before the peer went away can still be read, then read reports the end
+    xConnected->write(makeData(100, 1));
+    xConnected->close();
+    css::uno::Sequence<sal_Int8> aRead;
+    CPPUNIT_ASSERT_EQUAL(sal_Int32(100), xAccepted->read(aRead, 200));
+    CPPUNIT_ASSERT_EQUAL(sal_Int32(0), xAccepted->read(aRead, 200));
+    CPPUNIT_ASSERT_THROW(xAccepted->write(makeData(100, 2)), css::io::IOException);
+    CPPUNIT_ASSERT_THROW(xConnected->read(aRead, 1), css::io::IOException);
+
+    // dropping the last reference to a connection closes it, too; a reader blocked on it wakes up
+    css::uno::Reference<css::connection::XConnection> xAccepted2, xConnected2;
+    connect("shm,name=" + pipeName(u"gone") + ",size=4096", xAccepted2, xConnected2);
+    sal_Int32 nRead = -1;
+    std::thread aReader([&] { nRead = xAccepted2->read(aRead, 10); });
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    xConnected2.clear();
+    aReader.join();
+    CPPUNIT_ASSERT_EQUAL(sal_Int32(0), nRead);
+    xAccepted->close();
+    xAccepted2->close();
+}
+
+void Test::testStopAcceptingDuringHandshake()
+{
+    // a client that connects to the handshake pipe but never acknowledges the segment must not
+    // keep the acceptor from shutting down
+    const OUString aName(pipeName(u"handshake"));
+    css::uno::Reference<css::connection::XAcceptor> xAcceptor(
+        css::connection::Acceptor::create(getComponentContext()));
+    css::uno::Reference<css::connection::XConnection> xAccepted;
+    bool bReturned = false;
+    std::thread aAccept([&] {
+        xAccepted = xAcceptor->accept("shm,name=" + aName);
+        bReturned = true;
+    });
+
+    osl::StreamPipe aPipe;
+    for (int i = 0; i < 100 && !aPipe.is(); ++i)
+    {
+        aPipe = osl::StreamPipe(aName, osl_Pipe_OPEN, osl::Security());
+        if (!aPipe.is())
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    }
+    CPPUNIT_ASSERT(aPipe.is());
+    // once the segment name arrived the acceptor waits for our acknowledgement
+    sal_uInt32 nNameLen = 0;
+    CPPUNIT_ASSERT_EQUAL(sal_Int32(sizeof(nNameLen)), aPipe.read(&nNameLen, sizeof(nNameLen)));
+
+    xAcceptor->stopAccepting();
+    aAccept.join();
+    CPPUNIT_ASSERT(bReturned);
+    CPPUNIT_ASSERT(!xAccepted.is());
+    aPipe.close();
+}
+
+CPPUNIT_TEST_SUITE_REGISTRATION(Test);
+
+#endif
+
+}
+
+CPPUNIT_PLUGIN_IMPLEMENT();
+
+/* vim:set shiftwidth=4 softtabstop=4 expandtab: */
@@ -0,0 +1,117 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4; fill-column: 100 -*- */
+/*
+ * This file is part of the LibreOffice project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <sal/config.h>
+
+#include "acceptor.hxx"
+#include "../shm/shmconnection.hxx"
+
+#include <com/sun/star/connection/ConnectionSetupException.hpp>
+#include <com/sun/star/connection/XConnection.hpp>
+#include <osl/security.hxx>
+#include <sal/log.hxx>
+
+#include <utility>
+
+using namespace css::uno;
+using namespace css::connection;
+
+namespace io_acceptor
+{
+ShmAcceptor::ShmAcceptor(OUString sPipeName, sal_uInt32 nRingSize,
+                         OUString sConnectionDescription)
+    : m_sPipeName(std::move(sPipeName))
+    , m_sConnectionDescription(std::move(sConnectionDescription))
+    , m_nRingSize(nRingSize)
+    , m_bClosed(false)
+{
+}
+
+void ShmAcceptor::init()
+{
+    m_pipe = osl::Pipe(m_sPipeName.pData, osl_Pipe_CREATE, osl::Security());
+    if (!m_pipe.is())
+        throw ConnectionSetupException("io.acceptor: Couldn't setup shm handshake pipe "
+                                       + m_sPipeName);
+}
+
+Reference<XConnection> ShmAcceptor::accept()
+{
+    osl::Pipe pipe;
+    {
+        std::unique_lock guard(m_mutex);
+        pipe = m_pipe;
+    }
+    if (!pipe.is())
+        throw ConnectionSetupException("io.acceptor: shm handshake pipe already closed "
+                                       + m_sPipeName);
+
+    osl::StreamPipe aHandshake;
+    oslPipeError status = pipe.accept(aHandshake);
+
+    {
+        std::unique_lock guard(m_mutex);
+        if (m_bClosed)
+        {
+            // stopAccepting was called !
+            if (aHandshake.is())
+                aHandshake.close();
+            return Reference<XConnection>();
+        }
+        if (status == osl_Pipe_E_None)
+        {
+            // a client that connects but never completes the handshake must not be able to
+            // block stopAccepting
+            m_handshake = aHandshake;
+        }
+    }
+    if (status != osl_Pipe_E_None)
+        throw ConnectionSetupException("io.acceptor: Couldn't accept on shm handshake pipe "
+                                       + m_sPipeName);
+
+    SAL_INFO("io.acceptor", "shm connection on " << m_sPipeName);
+    Reference<XConnection> xConnection;
+    try
+    {
+        xConnection = io_shm::acceptConnection(aHandshake, m_nRingSize, m_sConnectionDescription);
+    }
+    catch (const ConnectionSetupException&)
+    {
+        std::unique_lock guard(m_mutex);
+        m_handshake.clear();
+        if (m_bClosed)
+            return Reference<XConnection>();
+        throw;
+    }
+    std::unique_lock guard(m_mutex);
+    m_handshake.clear();
+    return xConnection;
+}
+
+void ShmAcceptor::stopAccepting()
+{
+    osl::Pipe pipe;
+    osl::StreamPipe handshake;
+    {
+        std::unique_lock guard(m_mutex);
+        m_bClosed = true;
+        pipe = m_pipe;
+        m_pipe.clear();
+        handshake = m_handshake;
+        m_handshake.clear();
+    }
+    if (pipe.is())
+        pipe.close();
+    // wakes up acceptConnection() if it still waits for the connector's acknowledgement
+    if (handshake.is())
+        handshake.close();
+}
+}
+
+/* vim:set shiftwidth=4 softtabstop=4 expandtab cinoptions=b1,g0,N-s cinkeys+=0=break: */
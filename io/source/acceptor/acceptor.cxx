@@ -30,6 +30,7 @@
 #include <com/sun/star/uno/XComponentContext.hpp>
 
 #include "acceptor.hxx"
+#include "../shm/shmconnection.hxx"
 #include <memory>
 #include <mutex>
 #include <string_view>
@@ -60,6 +61,7 @@ namespace {
     private:
         std::unique_ptr<io_acceptor::PipeAcceptor> m_pPipe;
         std::unique_ptr<io_acceptor::SocketAcceptor> m_pSocket;
+        std::unique_ptr<io_acceptor::ShmAcceptor> m_pShm;
         std::mutex m_mutex;
         OUString m_sLastDescription;
         bool m_bInAccept;
@@ -174,6 +176,33 @@ Reference< XConnection > OAcceptor::accept( const OUString &sConnectionDescripti
                     throw;
                 }
             }
+            else if ( aDesc.getName() == "shm" )
+            {
+                if( !io_shm::isSupported() )
+                    throw ConnectionSetupException( u"Acceptor: shm transport not supported on this platform"_ustr );
+
+                OUString aName(
+                    aDesc.getParameter(
+                        u"name"_ustr));
+                sal_uInt32 nRingSize = io_shm::DEFAULT_RING_SIZE;
+                if (aDesc.hasParameter(u"size"_ustr))
+                    nRingSize = aDesc.getParameter(u"size"_ustr).toUInt32();
+
+                m_pShm.reset(new io_acceptor::ShmAcceptor(aName, nRingSize, sConnectionDescription));
+
+                try
+                {
+                    m_pShm->init();
+                }
+                catch( ... )
+                {
+                    {
+                        std::unique_lock g( m_mutex );
+                        m_pShm.reset();
+                    }
+                    throw;
+                }
+            }
             else
             {
                 OUString delegatee = "com.sun.star.connection.Acceptor." + aDesc.getName();
@@ -201,6 +230,10 @@ Reference< XConnection > OAcceptor::accept( const OUString &sConnectionDescripti
     {
         r = m_pSocket->accept();
     }
+    else if( m_pShm )
+    {
+        r = m_pShm->accept();
+    }
     else
     {
         r = _xAcceptor->accept(sConnectionDescription);
@@ -221,6 +254,10 @@ void SAL_CALL OAcceptor::stopAccepting(  )
     {
         m_pSocket->stopAccepting();
     }
+    else if ( m_pShm )
+    {
+        m_pShm->stopAccepting();
+    }
     else if( _xAcceptor.is() )
     {
         _xAcceptor->stopAccepting();
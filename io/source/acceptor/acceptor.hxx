@@ -47,6 +47,29 @@ namespace io_acceptor {
         bool m_bClosed;
     };
 
+    /** Accepts "shm" connections: the handshake runs over a pipe, the payload through
+        shared memory (see io_shm). */
+    class ShmAcceptor
+    {
+    public:
+        ShmAcceptor( OUString sPipeName, sal_uInt32 nRingSize, OUString sConnectionDescription );
+
+        void init();
+        css::uno::Reference < css::connection::XConnection > accept();
+
+        void stopAccepting();
+
+    private:
+        std::mutex m_mutex;
+        ::osl::Pipe m_pipe;
+        /// handshake of the connection being accepted, so that stopAccepting can interrupt it
+        ::osl::StreamPipe m_handshake;
+        OUString m_sPipeName;
+        OUString m_sConnectionDescription;
+        sal_uInt32 m_nRingSize;
+        bool m_bClosed;
+    };
+
     class SocketAcceptor
     {
     public:
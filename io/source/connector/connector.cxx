@@ -34,6 +34,7 @@
 #include <com/sun/star/uno/XComponentContext.hpp>
 
 #include "connector.hxx"
+#include "../shm/shmconnection.hxx"
 
 using namespace ::osl;
 using namespace ::cppu;
@@ -128,6 +129,25 @@ Reference< XConnection > SAL_CALL OConnector::connect( const OUString& sConnecti
             pConn->completeConnectionString();
             r = pConn;
         }
+        else if ( aDesc.getName() == "shm" )
+        {
+            if( !io_shm::isSupported() )
+                throw ConnectionSetupException( u"Connector : shm transport not supported on this platform"_ustr );
+
+            OUString aName(aDesc.getParameter(u"name"_ustr));
+
+            // the pipe is only used to learn the name of the shared memory segment
+            osl::StreamPipe aPipe( aName, osl_Pipe_OPEN, osl::Security() );
+            if( !aPipe.is() )
+            {
+                OUString const sMessage(
+                    "Connector : couldn't connect to shm handshake pipe \"" + aName + "\": "
+                    + OUString::number(aPipe.getError()));
+                SAL_WARN("io.connector", sMessage);
+                throw NoConnectException( sMessage );
+            }
+            r = io_shm::connectConnection( aPipe, sConnectionDescription );
+        }
         else
         {
             OUString delegatee= "com.sun.star.connection.Connector." + aDesc.getName();
@@ -0,0 +1,433 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4; fill-column: 100 -*- */
+/*
+ * This file is part of the LibreOffice project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <sal/config.h>
+
+#include "shmconnection.hxx"
+
+#include <com/sun/star/connection/ConnectionSetupException.hpp>
+#include <com/sun/star/connection/NoConnectException.hpp>
+#include <com/sun/star/connection/XConnection.hpp>
+#include <com/sun/star/io/IOException.hpp>
+#include <cppuhelper/implbase.hxx>
+#include <rtl/ref.hxx>
+#include <rtl/string.hxx>
+#include <sal/log.hxx>
+
+#if defined LINUX
+
+#include <algorithm>
+#include <atomic>
+#include <climits>
+#include <cstring>
+#include <utility>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <linux/futex.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+
+#endif
+
+using namespace css::uno;
+using namespace css::connection;
+
+#if defined LINUX
+
+namespace
+{
+constexpr sal_uInt32 SHM_MAGIC = 0x4c4f5348; // "LOSH"
+constexpr sal_uInt32 SHM_VERSION = 1;
+constexpr sal_uInt32 MIN_RING_SIZE = 4 * 1024;
+constexpr sal_uInt32 MAX_RING_SIZE = 256 * 1024 * 1024;
+// How long a blocked side sleeps before it checks whether the peer process still exists.
+constexpr long PEER_CHECK_INTERVAL_MS = 500;
+
+static_assert(std::atomic<sal_uInt32>::is_always_lock_free);
+static_assert(sizeof(std::atomic<sal_uInt32>) == sizeof(sal_uInt32));
+
+/// Control block of one direction; positions are free-running byte counters.
+struct ShmRing
+{
+    alignas(64) std::atomic<sal_uInt32> nHead; ///< bytes written so far, owned by the writer
+    alignas(64) std::atomic<sal_uInt32> nTail; ///< bytes read so far, owned by the reader
+    /// futex word, bumped on every change of nHead, nTail or bClosed
+    alignas(64) std::atomic<sal_uInt32> nSeq;
+    std::atomic<sal_uInt32> nWaiters;
+    std::atomic<sal_uInt32> bClosed;
+};
+
+struct ShmHeader
+{
+    sal_uInt32 nMagic;
+    sal_uInt32 nVersion;
+    sal_uInt32 nRingSize;
+    std::atomic<sal_Int32> nAcceptorPid;
+    std::atomic<sal_Int32> nConnectorPid;
+    /// [0] carries acceptor -> connector traffic, [1] connector -> acceptor
+    ShmRing aRing[2];
+};
+
+constexpr std::size_t HEADER_SIZE = (sizeof(ShmHeader) + 63) & ~std::size_t(63);
+
+std::size_t segmentSize(sal_uInt32 nRingSize) { return HEADER_SIZE + 2 * std::size_t(nRingSize); }
+
+sal_uInt32 normalizeRingSize(sal_uInt32 nSize)
+{
+    nSize = std::clamp(nSize, MIN_RING_SIZE, MAX_RING_SIZE);
+    sal_uInt32 n = MIN_RING_SIZE;
+    while (n < nSize)
+        n <<= 1;
+    return n;
+}
+
+sal_uInt32* futexWord(std::atomic<sal_uInt32>& rAtomic)
+{
+    return reinterpret_cast<sal_uInt32*>(&rAtomic);
+}
+
+void futexWait(std::atomic<sal_uInt32>& rWord, sal_uInt32 nExpected)
+{
+    timespec aTimeout{ 0, PEER_CHECK_INTERVAL_MS * 1000 * 1000 };
+    // not FUTEX_WAIT_PRIVATE: the word lives in memory shared with another process
+    syscall(SYS_futex, futexWord(rWord), FUTEX_WAIT, nExpected, &aTimeout, nullptr, 0);
+}
+
+void futexWakeAll(std::atomic<sal_uInt32>& rWord)
+{
+    syscall(SYS_futex, futexWord(rWord), FUTEX_WAKE, INT_MAX, nullptr, nullptr, 0);
+}
+
+void notify(ShmRing& rRing)
+{
+    rRing.nSeq.fetch_add(1);
+    if (rRing.nWaiters.load() != 0)
+        futexWakeAll(rRing.nSeq);
+}
+
+bool isAlive(sal_Int32 nPid) { return nPid == 0 || kill(nPid, 0) == 0 || errno != ESRCH; }
+
+class ShmConnection : public cppu::WeakImplHelper<XConnection>
+{
+public:
+    ShmConnection(void* pBase, std::size_t nSize, bool bAcceptor, OUString aDescription);
+    virtual ~ShmConnection() override;
+
+    virtual sal_Int32 SAL_CALL read(Sequence<sal_Int8>& aReadBytes,
+                                    sal_Int32 nBytesToRead) override;
+    virtual void SAL_CALL write(const Sequence<sal_Int8>& aData) override;
+    virtual void SAL_CALL flush() override;
+    virtual void SAL_CALL close() override;
+    virtual OUString SAL_CALL getDescription() override;
+
+private:
+    /** Block until rReady() holds; returns false if the connection got closed (by either side)
+        or the peer process died in the meantime. */
+    template <typename Pred> bool waitFor(ShmRing& rRing, Pred rReady);
+
+    /** The peer process writes one of the two positions of every ring, so never trust them:
+        more than a ring full of pending bytes means the shared block got corrupted.
+
+        @throws css::io::IOException after closing the connection
+    */
+    void checkPending(sal_uInt32 nHead, sal_uInt32 nTail);
+
+    void* m_pBase;
+    std::size_t m_nSize;
+    ShmHeader* m_pHeader;
+    ShmRing& m_rIn;
+    ShmRing& m_rOut;
+    sal_Int8* m_pInData;
+    sal_Int8* m_pOutData;
+    sal_uInt32 m_nMask;
+    std::atomic<sal_Int32>& m_rPeerPid;
+    oslInterlockedCount m_nStatus;
+    OUString m_sDescription;
+};
+
+ShmConnection::ShmConnection(void* pBase, std::size_t nSize, bool bAcceptor,
+                             OUString aDescription)
+    : m_pBase(pBase)
+    , m_nSize(nSize)
+    , m_pHeader(static_cast<ShmHeader*>(pBase))
+    , m_rIn(m_pHeader->aRing[bAcceptor ? 1 : 0])
+    , m_rOut(m_pHeader->aRing[bAcceptor ? 0 : 1])
+    , m_pInData(static_cast<sal_Int8*>(pBase) + HEADER_SIZE
+                + (bAcceptor ? m_pHeader->nRingSize : 0))
+    , m_pOutData(static_cast<sal_Int8*>(pBase) + HEADER_SIZE
+                 + (bAcceptor ? 0 : m_pHeader->nRingSize))
+    , m_nMask(m_pHeader->nRingSize - 1)
+    , m_rPeerPid(bAcceptor ? m_pHeader->nConnectorPid : m_pHeader->nAcceptorPid)
+    , m_nStatus(0)
+    , m_sDescription(std::move(aDescription))
+{
+    // make it unique
+    m_sDescription += ",uniqueValue="
+                      + OUString::number(sal::static_int_cast<sal_Int64>(
+                            reinterpret_cast<sal_IntPtr>(this)));
+}
+
+ShmConnection::~ShmConnection()
+{
+    close();
+    munmap(m_pBase, m_nSize);
+}
+
+template <typename Pred> bool ShmConnection::waitFor(ShmRing& rRing, Pred rReady)
+{
+    for (;;)
+    {
+        sal_uInt32 nSeq = rRing.nSeq.load();
+        if (rReady())
+            return true;
+        if (m_nStatus || rRing.bClosed.load())
+            return false;
+        rRing.nWaiters.fetch_add(1);
+        futexWait(rRing.nSeq, nSeq);
+        rRing.nWaiters.fetch_sub(1);
+        if (!isAlive(m_rPeerPid.load()))
+        {
+            SAL_WARN("io.shm", "peer process of " << m_sDescription << " vanished");
+            rRing.bClosed.store(1);
+            return rReady();
+        }
+    }
+}
+
+void ShmConnection::checkPending(sal_uInt32 nHead, sal_uInt32 nTail)
+{
+    if (nHead - nTail <= m_nMask + 1)
+        return;
+    SAL_WARN("io.shm", "inconsistent ring positions on " << m_sDescription << ": head " << nHead
+                                                         << ", tail " << nTail);
+    close();
+    throw css::io::IOException(u"shm connection corrupted by peer"_ustr);
+}
+
+sal_Int32 ShmConnection::read(Sequence<sal_Int8>& aReadBytes, sal_Int32 nBytesToRead)
+{
+    if (m_nStatus)
+        throw css::io::IOException(u"shm connection already closed"_ustr);
+    if (aReadBytes.getLength() < nBytesToRead)
+        aReadBytes.realloc(nBytesToRead);
+
+    sal_Int8* pDest = aReadBytes.getArray();
+    sal_uInt32 nTail = m_rIn.nTail.load(std::memory_order_relaxed);
+    sal_Int32 nRead = 0;
+    while (nRead < nBytesToRead)
+    {
+        sal_uInt32 nHead = 0;
+        if (!waitFor(m_rIn, [&] {
+                nHead = m_rIn.nHead.load(std::memory_order_acquire);
+                return nHead != nTail;
+            }))
+            break;
+        checkPending(nHead, nTail);
+        sal_uInt32 nChunk = std::min<sal_uInt32>(nHead - nTail, nBytesToRead - nRead);
+        sal_uInt32 nOffset = nTail & m_nMask;
+        sal_uInt32 nFirst = std::min(nChunk, m_nMask + 1 - nOffset);
+        memcpy(pDest + nRead, m_pInData + nOffset, nFirst);
+        memcpy(pDest + nRead + nFirst, m_pInData, nChunk - nFirst);
+        nTail += nChunk;
+        nRead += nChunk;
+        m_rIn.nTail.store(nTail, std::memory_order_release);
+        notify(m_rIn);
+    }
+    if (nRead < aReadBytes.getLength())
+        aReadBytes.realloc(nRead);
+    return nRead;
+}
+
+void ShmConnection::write(const Sequence<sal_Int8>& aData)
+{
+    if (m_nStatus)
+        throw css::io::IOException(u"shm connection already closed"_ustr);
+
+    const sal_Int8* pSrc = aData.getConstArray();
+    const sal_uInt32 nCapacity = m_nMask + 1;
+    sal_uInt32 nHead = m_rOut.nHead.load(std::memory_order_relaxed);
+    sal_Int32 nWritten = 0;
+    while (nWritten < aData.getLength())
+    {
+        sal_uInt32 nTail = 0;
+        if (!waitFor(m_rOut, [&] {
+                nTail = m_rOut.nTail.load(std::memory_order_acquire);
+                return nHead - nTail != nCapacity;
+            }))
+            throw css::io::IOException(u"short write"_ustr);
+        if (m_rOut.bClosed.load())
+            throw css::io::IOException(u"shm connection closed by peer"_ustr);
+        checkPending(nHead, nTail);
+        sal_uInt32 nChunk
+            = std::min<sal_uInt32>(nCapacity - (nHead - nTail), aData.getLength() - nWritten);
+        sal_uInt32 nOffset = nHead & m_nMask;
+        sal_uInt32 nFirst = std::min(nChunk, nCapacity - nOffset);
+        memcpy(m_pOutData + nOffset, pSrc + nWritten, nFirst);
+        memcpy(m_pOutData, pSrc + nWritten + nFirst, nChunk - nFirst);
+        nHead += nChunk;
+        nWritten += nChunk;
+        m_rOut.nHead.store(nHead, std::memory_order_release);
+        notify(m_rOut);
+    }
+}
+
+void ShmConnection::flush() {}
+
+void ShmConnection::close()
+{
+    // ensure that close is called only once
+    if (1 == osl_atomic_increment(&m_nStatus))
+    {
+        for (ShmRing& rRing : m_pHeader->aRing)
+        {
+            rRing.bClosed.store(1);
+            notify(rRing);
+        }
+    }
+}
+
+OUString ShmConnection::getDescription() { return m_sDescription; }
+
+void* mapSegment(int nFd, std::size_t nSize)
+{
+    void* p = mmap(nullptr, nSize, PROT_READ | PROT_WRITE, MAP_SHARED, nFd, 0);
+    return p == MAP_FAILED ? nullptr : p;
+}
+
+OString makeSegmentName()
+{
+    static std::atomic<sal_uInt32> s_nCounter(0);
+    return "/lo_uno_shm_" + OString::number(sal_Int32(getpid())) + "_"
+           + OString::number(s_nCounter.fetch_add(1)) + "_"
+           + OString::number(sal_Int64(time(nullptr)));
+}
+}
+
+namespace io_shm
+{
+bool isSupported() { return true; }
+
+Reference<XConnection> acceptConnection(osl::StreamPipe& rPipe, sal_uInt32 nRingSize,
+                                        const OUString& rDescription)
+{
+    nRingSize = normalizeRingSize(nRingSize);
+    const std::size_t nSize = segmentSize(nRingSize);
+    const OString aName(makeSegmentName());
+
+    int nFd = shm_open(aName.getStr(), O_RDWR | O_CREAT | O_EXCL, S_IRUSR | S_IWUSR);
+    if (nFd == -1)
+        throw ConnectionSetupException("io.shm: cannot create segment "
+                                       + OStringToOUString(aName, RTL_TEXTENCODING_ASCII_US));
+    void* pBase = nullptr;
+    if (ftruncate(nFd, nSize) == 0)
+        pBase = mapSegment(nFd, nSize);
+    ::close(nFd);
+    if (!pBase)
+    {
+        shm_unlink(aName.getStr());
+        throw ConnectionSetupException(u"io.shm: cannot map segment"_ustr);
+    }
+
+    // ftruncate zero-fills, so all positions and flags already start out as 0
+    ShmHeader* pHeader = static_cast<ShmHeader*>(pBase);
+    pHeader->nRingSize = nRingSize;
+    pHeader->nVersion = SHM_VERSION;
+    pHeader->nAcceptorPid.store(getpid());
+    std::atomic_thread_fence(std::memory_order_release);
+    pHeader->nMagic = SHM_MAGIC;
+
+    // announce the segment, then wait until the peer acknowledges it has mapped it
+    sal_uInt32 nNameLen = aName.getLength();
+    sal_Int8 nAck = 0;
+    bool bOk = rPipe.write(&nNameLen, sizeof(nNameLen)) == sizeof(nNameLen)
+               && rPipe.write(aName.getStr(), nNameLen) == sal_Int32(nNameLen)
+               && rPipe.read(&nAck, 1) == 1 && nAck == 1;
+    shm_unlink(aName.getStr());
+    rPipe.close();
+    if (!bOk)
+    {
+        munmap(pBase, nSize);
+        throw ConnectionSetupException(u"io.shm: handshake with connector failed"_ustr);
+    }
+    return new ShmConnection(pBase, nSize, true, rDescription);
+}
+
+Reference<XConnection> connectConnection(osl::StreamPipe& rPipe, const OUString& rDescription)
+{
+    sal_uInt32 nNameLen = 0;
+    if (rPipe.read(&nNameLen, sizeof(nNameLen)) != sizeof(nNameLen) || nNameLen == 0
+        || nNameLen > 255)
+        throw NoConnectException(u"io.shm: no segment announced by acceptor"_ustr);
+    char aNameBuf[256];
+    if (rPipe.read(aNameBuf, nNameLen) != sal_Int32(nNameLen))
+        throw NoConnectException(u"io.shm: no segment announced by acceptor"_ustr);
+    aNameBuf[nNameLen] = 0;
+
+    int nFd = shm_open(aNameBuf, O_RDWR, 0);
+    if (nFd == -1)
+        throw NoConnectException(u"io.shm: cannot open segment"_ustr);
+    struct stat aStat;
+    void* pBase = nullptr;
+    std::size_t nSize = 0;
+    if (fstat(nFd, &aStat) == 0 && std::size_t(aStat.st_size) > HEADER_SIZE)
+    {
+        nSize = aStat.st_size;
+        pBase = mapSegment(nFd, nSize);
+    }
+    ::close(nFd);
+    if (!pBase)
+        throw NoConnectException(u"io.shm: cannot map segment"_ustr);
+
+    ShmHeader* pHeader = static_cast<ShmHeader*>(pBase);
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (pHeader->nMagic != SHM_MAGIC || pHeader->nVersion != SHM_VERSION
+        || pHeader->nRingSize != normalizeRingSize(pHeader->nRingSize)
+        || segmentSize(pHeader->nRingSize) != nSize)
+    {
+        munmap(pBase, nSize);
+        throw NoConnectException(u"io.shm: segment layout mismatch"_ustr);
+    }
+    pHeader->nConnectorPid.store(getpid());
+
+    sal_Int8 nAck = 1;
+    if (rPipe.write(&nAck, 1) != 1)
+    {
+        munmap(pBase, nSize);
+        throw NoConnectException(u"io.shm: handshake with acceptor failed"_ustr);
+    }
+    rPipe.close();
+    return new ShmConnection(pBase, nSize, false, rDescription);
+}
+}
+
+#else
+
+namespace io_shm
+{
+bool isSupported() { return false; }
+
+Reference<XConnection> acceptConnection(osl::StreamPipe&, sal_uInt32, const OUString&)
+{
+    throw ConnectionSetupException(u"io.shm: shared memory transport not supported"_ustr);
+}
+
+Reference<XConnection> connectConnection(osl::StreamPipe&, const OUString&)
+{
+    throw ConnectionSetupException(u"io.shm: shared memory transport not supported"_ustr);
+}
+}
+
+#endif
+
+/* vim:set shiftwidth=4 softtabstop=4 expandtab cinoptions=b1,g0,N-s cinkeys+=0=break: */
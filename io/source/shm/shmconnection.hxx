@@ -0,0 +1,63 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4; fill-column: 100 -*- */
+/*
+ * This file is part of the LibreOffice project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <sal/config.h>
+
+#include <com/sun/star/uno/Reference.hxx>
+#include <osl/pipe.hxx>
+#include <rtl/ustring.hxx>
+
+namespace com::sun::star::connection
+{
+class XConnection;
+}
+
+/** Shared memory transport for UNO remote bridges between processes on the same host.
+
+    Selected with a connection description of the form "shm,name=<name>[,size=<bytes>]".
+
+    The rendezvous happens over an ordinary osl::Pipe called <name>.  For every accepted
+    connection the acceptor creates a fresh POSIX shared memory segment holding one
+    single-producer/single-consumer ring buffer per direction, announces the segment name over
+    the pipe and unlinks it again as soon as the connector has mapped it, so nothing is left
+    behind in /dev/shm once both sides are gone.  All further traffic is copied straight into
+    and out of the rings; a side that finds its ring empty (reader) or full (writer) sleeps on a
+    process-shared futex, so no system call is made while data is flowing.
+
+    Only implemented on Linux; elsewhere isSupported() returns false and the functions below
+    throw ConnectionSetupException.
+*/
+namespace io_shm
+{
+/// Default capacity of each of the two ring buffers of a connection.
+constexpr sal_uInt32 DEFAULT_RING_SIZE = 1024 * 1024;
+
+bool isSupported();
+
+/** Create the segment for a freshly accepted handshake pipe and wait for the peer to map it.
+
+    @param nRingSize
+    requested capacity of each ring, rounded up to a power of two and clamped to a sane range
+
+    @throws css::connection::ConnectionSetupException
+*/
+css::uno::Reference<css::connection::XConnection>
+acceptConnection(osl::StreamPipe& rPipe, sal_uInt32 nRingSize, const OUString& rDescription);
+
+/** Map the segment announced by the acceptor on the other end of rPipe.
+
+    @throws css::connection::NoConnectException
+*/
+css::uno::Reference<css::connection::XConnection> connectConnection(osl::StreamPipe& rPipe,
+                                                                    const OUString& rDescription);
+}
+
+/* vim:set shiftwidth=4 softtabstop=4 expandtab cinoptions=b1,g0,N-s cinkeys+=0=break: */
@@ -10,6 +10,11 @@
 #include <stdio.h>
 #include <string.h>
 #include <cmath>
+#ifndef IOS
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
 
 #include <vector>
 #include <atomic>
@@ -37,6 +42,9 @@ static int help( const char *error = nullptr )
     fprintf( stderr, "\t--tile\t[max parts|-1] [max tiles|-1]\n" );
     fprintf( stderr, "\t--dialog\t<.uno:Command>\n" );
     fprintf( stderr, "\t--join\trun tile joining tests\n" );
+    fprintf( stderr, "\t--convert\t<count> <output dir> [format|pdf] [memory limit in MB]\n"
+                     "\t\tforks <count> children one after another, each converting the document,\n"
+                     "\t\tand reports conversions per second; compare runs with and without --preinit\n" );
     return 1;
 }
 
@@ -557,6 +565,64 @@ static void ignoreCallback(const int /*type*/, const char* /*p*/, void* /*data*/
 {
 }
 
+#ifndef IOS
+/// Converts the document in freshly forked children, the way a pre-initialized (zygote) parent
+/// serves conversion requests. Without --preinit each child pays the full initialization.
+static int testConvert(const char *pInstallPath, const char *pUserProfile, const char *pDocUrl,
+                       int argc, char* argv[])
+{
+    if (argc < 2)
+        return help("missing arguments to --convert");
+
+    const int nCount = atoi(argv[0]);
+    const std::string aOutDir(argv[1]);
+    const char *pFormat = argc > 2 ? argv[2] : "pdf";
+    const long nMemoryLimitMB = argc > 3 ? atol(argv[3]) : 0;
+
+    int nFailed = 0;
+    const double fStart = getTimeNow();
+    for (int i = 0; i < nCount; ++i)
+    {
+        const pid_t nPid = fork();
+        if (nPid < 0)
+        {
+            perror("fork");
+            return 1;
+        }
+        if (nPid == 0)
+        {
+            if (nMemoryLimitMB > 0)
+            {
+                rlimit aLimit;
+                aLimit.rlim_cur = aLimit.rlim_max = static_cast<rlim_t>(nMemoryLimitMB) * 1024 * 1024;
+                setrlimit(RLIMIT_AS, &aLimit);
+            }
+
+            std::unique_ptr<Office> pOffice(lok_cpp_init(pInstallPath, pUserProfile));
+            if (!pOffice)
+                _exit(1);
+            pOffice->registerCallback(ignoreCallback, nullptr);
+            std::unique_ptr<Document> pDocument(pOffice->documentLoad(pDocUrl));
+            if (!pDocument)
+                _exit(1);
+            const std::string aOutput
+                = aOutDir + "/convert-" + std::to_string(i) + "." + pFormat;
+            // No clean shutdown, as a zygote child would just go away as well.
+            _exit(pDocument->saveAs(aOutput.c_str(), pFormat) ? 0 : 1);
+        }
+
+        int nStatus = 0;
+        if (waitpid(nPid, &nStatus, 0) != nPid || !WIFEXITED(nStatus) || WEXITSTATUS(nStatus) != 0)
+            ++nFailed;
+    }
+    const double fElapsed = getTimeNow() - fStart;
+
+    fprintf(stderr, "%d conversions (%d failed) in %2.4f(s): %2.2f per second\n",
+            nCount, nFailed, fElapsed, fElapsed > 0.0 ? nCount / fElapsed : 0.0);
+    return nFailed ? 1 : 0;
+}
+#endif
+
 int main( int argc, char* argv[] )
 {
     int arg = 2;
@@ -606,6 +672,10 @@ int main( int argc, char* argv[] )
         lok_preinit(argv[1], user_url.c_str());
         aTimes.emplace_back();
     }
+
+    if (!strcmp(mode, "--convert"))
+        return testConvert(argv[1], user_url.c_str(), doc_url, argc - arg, argv + arg);
+
     const char *install_path = argv[1];
     const char *user_profile = user_url.c_str();
 #else
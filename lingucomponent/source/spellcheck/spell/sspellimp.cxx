@@ -47,6 +47,7 @@
 #include <rtl/textenc.h>
 #include <sal/log.hxx>
 
+#include <algorithm>
 #include <numeric>
 #include <utility>
 #include <vector>
@@ -224,23 +225,40 @@ Sequence< Locale > SAL_CALL SpellChecker::getLocales()
     return m_aSuppLocales;
 }
 
-sal_Bool SAL_CALL SpellChecker::hasLocale(const Locale& rLocale)
+void SpellChecker::UpdateLastLocale(const Locale& rLocale)
 {
-    MutexGuard  aGuard( GetLinguMutex() );
+    if (m_bLastLocaleValid && rLocale == m_aLastLocale)
+        return;
 
-    bool bRes = false;
     if (!m_aSuppLocales.hasElements())
         getLocales();
 
-    for (auto const& suppLocale : m_aSuppLocales)
+    const Sequence<Locale>& rSuppLocales = m_aSuppLocales;
+    m_bLastLocaleSupported = std::find(rSuppLocales.begin(), rSuppLocales.end(), rLocale)
+                             != rSuppLocales.end();
+    m_aLastLocaleDicts.clear();
+    for (size_t i = 0; i < m_DictItems.size(); ++i)
     {
-        if (rLocale == suppLocale)
-        {
-            bRes = true;
-            break;
-        }
+        if (rLocale == m_DictItems[i].m_aDLoc)
+            m_aLastLocaleDicts.push_back(i);
     }
-    return bRes;
+    m_aLastLocale = rLocale;
+    // without any dictionary getLocales() is retried on the next call
+    m_bLastLocaleValid = m_aSuppLocales.hasElements();
+}
+
+const std::vector<size_t>& SpellChecker::GetLocaleDicts(const Locale& rLocale)
+{
+    UpdateLastLocale(rLocale);
+    return m_aLastLocaleDicts;
+}
+
+sal_Bool SAL_CALL SpellChecker::hasLocale(const Locale& rLocale)
+{
+    MutexGuard  aGuard( GetLinguMutex() );
+
+    UpdateLastLocale(rLocale);
+    return m_bLastLocaleSupported;
 }
 
 sal_Int16 SpellChecker::GetSpellFailure(const OUString &rWord, const Locale &rLocale, int& rInfo)
@@ -281,44 +299,40 @@ sal_Int16 SpellChecker::GetSpellFailure(const OUString &rWord, const Locale &rLo
 
     if (n)
     {
-        for (auto& currDict : m_DictItems)
+        for (size_t nDict : GetLocaleDicts(rLocale))
         {
-            pMS = nullptr;
-            eEnc = RTL_TEXTENCODING_DONTKNOW;
+            DictItem& currDict = m_DictItems[nDict];
 
-            if (rLocale == currDict.m_aDLoc)
+            if (!currDict.m_pDict)
             {
-                if (!currDict.m_pDict)
-                {
-                    OUString dicpath = currDict.m_aDName + ".dic";
-                    OUString affpath = currDict.m_aDName + ".aff";
-                    OUString dict;
-                    OUString aff;
-                    osl::FileBase::getSystemPathFromFileURL(dicpath,dict);
-                    osl::FileBase::getSystemPathFromFileURL(affpath,aff);
+                OUString dicpath = currDict.m_aDName + ".dic";
+                OUString affpath = currDict.m_aDName + ".aff";
+                OUString dict;
+                OUString aff;
+                osl::FileBase::getSystemPathFromFileURL(dicpath,dict);
+                osl::FileBase::getSystemPathFromFileURL(affpath,aff);
 #if defined(_WIN32)
-                    // workaround for Windows specific problem that the
-                    // path length in calls to 'fopen' is limited to somewhat
-                    // about 120+ characters which will usually be exceed when
-                    // using dictionaries as extensions. (Hunspell waits UTF-8 encoded
-                    // path with \\?\ long path prefix.)
-                    OString aTmpaff = Win_AddLongPathPrefix(OUStringToOString(aff, RTL_TEXTENCODING_UTF8));
-                    OString aTmpdict = Win_AddLongPathPrefix(OUStringToOString(dict, RTL_TEXTENCODING_UTF8));
+                // workaround for Windows specific problem that the
+                // path length in calls to 'fopen' is limited to somewhat
+                // about 120+ characters which will usually be exceed when
+                // using dictionaries as extensions. (Hunspell waits UTF-8 encoded
+                // path with \\?\ long path prefix.)
+                OString aTmpaff = Win_AddLongPathPrefix(OUStringToOString(aff, RTL_TEXTENCODING_UTF8));
+                OString aTmpdict = Win_AddLongPathPrefix(OUStringToOString(dict, RTL_TEXTENCODING_UTF8));
 #else
-                    OString aTmpaff(OU2ENC(aff,osl_getThreadTextEncoding()));
-                    OString aTmpdict(OU2ENC(dict,osl_getThreadTextEncoding()));
+                OString aTmpaff(OU2ENC(aff,osl_getThreadTextEncoding()));
+                OString aTmpdict(OU2ENC(dict,osl_getThreadTextEncoding()));
 #endif
 
-                    currDict.m_pDict = std::make_unique<Hunspell>(aTmpaff.getStr(),aTmpdict.getStr());
+                currDict.m_pDict = std::make_unique<Hunspell>(aTmpaff.getStr(),aTmpdict.getStr());
 #if defined(H_DEPRECATED)
-                    currDict.m_aDEnc = getTextEncodingFromCharset(currDict.m_pDict->get_dict_encoding().c_str());
+                currDict.m_aDEnc = getTextEncodingFromCharset(currDict.m_pDict->get_dict_encoding().c_str());
 #else
-                    currDict.m_aDEnc = getTextEncodingFromCharset(currDict.m_pDict->get_dic_encoding());
+                currDict.m_aDEnc = getTextEncodingFromCharset(currDict.m_pDict->get_dic_encoding());
 #endif
-                }
-                pMS  = currDict.m_pDict.get();
-                eEnc = currDict.m_aDEnc;
             }
+            pMS  = currDict.m_pDict.get();
+            eEnc = currDict.m_aDEnc;
 
             if (pMS)
             {
@@ -456,16 +470,11 @@ Reference< XSpellAlternatives >
         int numsug = 0;
 
         Sequence< OUString > aStr( 0 );
-        for (const auto& currDict : m_DictItems)
+        for (size_t nDict : GetLocaleDicts(rLocale))
         {
-            pMS = nullptr;
-            eEnc = RTL_TEXTENCODING_DONTKNOW;
-
-            if (rLocale == currDict.m_aDLoc)
-            {
-                pMS  = currDict.m_pDict.get();
-                eEnc = currDict.m_aDEnc;
-            }
+            const DictItem& currDict = m_DictItems[nDict];
+            pMS  = currDict.m_pDict.get();
+            eEnc = currDict.m_aDEnc;
 
             if (pMS)
             {
@@ -33,6 +33,7 @@
 #include <linguistic/lngprophelp.hxx>
 
 #include <memory>
+#include <vector>
 
 #include <hunspell.hxx>
 
@@ -66,6 +67,14 @@ class SpellChecker :
 
     Sequence< Locale >                 m_aSuppLocales;
 
+    // The locale of the previous lookup and what it resolved to: consecutive
+    // words nearly always share their locale, so avoid searching all
+    // supported locales and dictionaries for every single word.
+    Locale                             m_aLastLocale;
+    std::vector<size_t>                m_aLastLocaleDicts;
+    bool                               m_bLastLocaleSupported = false;
+    bool                               m_bLastLocaleValid = false;
+
     ::comphelper::OInterfaceContainerHelper3<XEventListener> m_aEvtListeners;
     std::unique_ptr<linguistic::PropertyHelper_Spelling> m_pPropHelper;
     bool                                    m_bDisposing;
@@ -79,6 +88,9 @@ class SpellChecker :
         return m_pPropHelper ? *m_pPropHelper : GetPropHelper_Impl();
     }
 
+    void        UpdateLastLocale( const Locale& rLocale );
+    /// Indices into m_DictItems of the dictionaries for rLocale
+    const std::vector<size_t>& GetLocaleDicts( const Locale& rLocale );
     sal_Int16   GetSpellFailure( const OUString &rWord, const Locale &rLocale, int& rInfo );
     Reference< XSpellAlternatives > GetProposals( const OUString &rWord, const Locale &rLocale );
 
@@ -30,8 +30,9 @@
 #include <rtl/ref.hxx>
 #include <i18nlangtag/lang.h>
 
-#include <set>
 #include <map>
+#include <optional>
+#include <unordered_map>
 
 namespace linguistic
 {
@@ -69,26 +70,53 @@ public:
 };
 
 
+/** Remembers the verdict of the spell checker services for recently checked words.
+
+    Words are kept per language in two generations: once the current generation
+    exceeds the capacity it becomes the previous one and the oldest words are
+    dropped, words found in the previous generation are moved back into the
+    current one. That way frequently used words survive a clean-up.
+ */
 class SpellCache final
 {
     rtl::Reference<FlushListener>  mxFlushLstnr;
 
-    typedef std::set< OUString >                  WordList_t;
-    typedef std::map< LanguageType, WordList_t >  LangWordList_t;
+    // word -> true if it is correct, false if it is misspelled
+    typedef std::unordered_map< OUString, bool >  WordList_t;
+    struct WordLists_t
+    {
+        WordList_t  aCurrent;
+        WordList_t  aPrevious;
+    };
+    typedef std::map< LanguageType, WordLists_t >  LangWordList_t;
     LangWordList_t  aWordLists;
 
+    size_t          mnCapacity;
+    sal_uInt64      mnHits;
+    sal_uInt64      mnMisses;
+
     SpellCache(const SpellCache &) = delete;
     SpellCache & operator = (const SpellCache &) = delete;
 
 public:
-    SpellCache();
+    /// nCapacity is the number of words kept per language and generation
+    explicit SpellCache( size_t nCapacity = 2048 );
     ~SpellCache();
 
     // called from FlushListener
     void    Flush();
 
-    void    AddWord( const OUString& rWord, LanguageType nLang );
-    bool    CheckWord( const OUString& rWord, LanguageType nLang );
+    void    AddWord( const OUString& rWord, LanguageType nLang, bool bCorrect = true );
+    /// @return the remembered verdict, or nothing if the word is not known
+    std::optional<bool> LookUpWord( const OUString& rWord, LanguageType nLang );
+    bool    CheckWord( const OUString& rWord, LanguageType nLang )
+    {
+        std::optional<bool> oRes = LookUpWord( rWord, nLang );
+        return oRes && *oRes;
+    }
+
+    sal_uInt64  GetHits() const     { return mnHits; }
+    sal_uInt64  GetMisses() const   { return mnMisses; }
 };
 
 
@@ -0,0 +1,231 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+/*
+ * This file is part of the LibreOffice project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <sal/config.h>
+
+#include <com/sun/star/lang/XComponent.hpp>
+#include <com/sun/star/linguistic2/ProofreadingIterator.hpp>
+#include <com/sun/star/text/TextMarkupType.hpp>
+#include <com/sun/star/text/XFlatParagraph.hpp>
+#include <com/sun/star/text/XFlatParagraphIterator.hpp>
+#include <com/sun/star/text/XFlatParagraphIteratorProvider.hpp>
+#include <comphelper/interfacecontainer4.hxx>
+#include <cppuhelper/implbase.hxx>
+#include <osl/conditn.hxx>
+#include <rtl/ref.hxx>
+#include <unotest/bootstrapfixturebase.hxx>
+
+#include <atomic>
+#include <mutex>
+
+using namespace ::com::sun::star;
+using namespace ::com::sun::star::uno;
+
+namespace
+{
+// long enough for the checking thread to get to a paragraph on a busy machine
+const TimeValue aTimeout = { 30, 0 };
+
+/// Flat paragraph that can hold the checking thread in getText() until it is released.
+class MockFlatParagraph : public cppu::WeakImplHelper<text::XFlatParagraph>
+{
+    OUString m_aText;
+    osl::Condition m_aRelease;
+    osl::Condition m_aReached;
+    osl::Condition m_aChecked;
+    std::atomic<sal_Int32> m_nTextCalls;
+
+public:
+    MockFlatParagraph(const OUString& rText, bool bBlock)
+        : m_aText(rText)
+        , m_nTextCalls(0)
+    {
+        if (!bBlock)
+            m_aRelease.set();
+    }
+
+    void Release() { m_aRelease.set(); }
+    bool WaitReached() { return m_aReached.wait(&aTimeout) == osl::Condition::result_ok; }
+    bool WaitChecked() { return m_aChecked.wait(&aTimeout) == osl::Condition::result_ok; }
+    sal_Int32 GetTextCalls() const { return m_nTextCalls; }
+
+    // XFlatParagraph
+    virtual OUString SAL_CALL getText() override
+    {
+        ++m_nTextCalls;
+        m_aReached.set();
+        m_aRelease.wait(&aTimeout);
+        return m_aText;
+    }
+    virtual sal_Bool SAL_CALL isModified() override { return false; }
+    virtual void SAL_CALL setChecked(sal_Int32 nType, sal_Bool bVal) override
+    {
+        if (nType == text::TextMarkupType::PROOFREADING && bVal)
+            m_aChecked.set();
+    }
+    virtual sal_Bool SAL_CALL isChecked(sal_Int32) override { return m_aChecked.check(); }
+    virtual lang::Locale SAL_CALL getLanguageOfText(sal_Int32, sal_Int32) override
+    {
+        // no grammar checker is configured for it
+        return lang::Locale(u"zxx"_ustr, OUString(), OUString());
+    }
+    virtual lang::Locale SAL_CALL getPrimaryLanguageOfText(sal_Int32 nPos, sal_Int32 nLen) override
+    {
+        return getLanguageOfText(nPos, nLen);
+    }
+    virtual void SAL_CALL changeText(sal_Int32, sal_Int32, const OUString&,
+                                     const Sequence<beans::PropertyValue>&) override
+    {
+    }
+    virtual void SAL_CALL changeAttributes(sal_Int32, sal_Int32,
+                                           const Sequence<beans::PropertyValue>&) override
+    {
+    }
+    virtual Sequence<sal_Int32> SAL_CALL getLanguagePortions() override { return {}; }
+
+    // XTextMarkup
+    virtual Reference<container::XStringKeyMap> SAL_CALL getMarkupInfoContainer() override
+    {
+        return nullptr;
+    }
+    virtual void SAL_CALL commitStringMarkup(sal_Int32, const OUString&, sal_Int32, sal_Int32,
+                                             const Reference<container::XStringKeyMap>&) override
+    {
+    }
+    virtual void SAL_CALL commitTextRangeMarkup(sal_Int32, const OUString&,
+                                                const Reference<text::XTextRange>&,
+                                                const Reference<container::XStringKeyMap>&) override
+    {
+    }
+};
+
+/// Document with a single paragraph that notifies its listeners when it is disposed.
+class MockDocument
+    : public cppu::WeakImplHelper<lang::XComponent, text::XFlatParagraphIteratorProvider,
+                                  text::XFlatParagraphIterator>
+{
+    rtl::Reference<MockFlatParagraph> m_xPara;
+    std::mutex m_aMutex;
+    comphelper::OInterfaceContainerHelper4<lang::XEventListener> m_aListeners;
+
+public:
+    explicit MockDocument(const rtl::Reference<MockFlatParagraph>& rxPara)
+        : m_xPara(rxPara)
+    {
+    }
+
+    // XComponent
+    virtual void SAL_CALL dispose() override
+    {
+        std::unique_lock aGuard(m_aMutex);
+        m_aListeners.disposeAndClear(aGuard, lang::EventObject(getXWeak()));
+    }
+    virtual void SAL_CALL addEventListener(const Reference<lang::XEventListener>& rxListener) override
+    {
+        std::unique_lock aGuard(m_aMutex);
+        m_aListeners.addInterface(aGuard, rxListener);
+    }
+    virtual void SAL_CALL
+    removeEventListener(const Reference<lang::XEventListener>& rxListener) override
+    {
+        std::unique_lock aGuard(m_aMutex);
+        m_aListeners.removeInterface(aGuard, rxListener);
+    }
+
+    // XFlatParagraphIteratorProvider
+    virtual Reference<text::XFlatParagraphIterator>
+        SAL_CALL getFlatParagraphIterator(sal_Int32, sal_Bool) override
+    {
+        return this;
+    }
+
+    // XFlatParagraphIterator
+    virtual Reference<text::XFlatParagraph> SAL_CALL getFirstPara() override { return m_xPara; }
+    virtual Reference<text::XFlatParagraph> SAL_CALL getNextPara() override { return nullptr; }
+    virtual Reference<text::XFlatParagraph> SAL_CALL getLastPara() override { return m_xPara; }
+    virtual Reference<text::XFlatParagraph>
+        SAL_CALL getParaBefore(const Reference<text::XFlatParagraph>&) override
+    {
+        return nullptr;
+    }
+    virtual Reference<text::XFlatParagraph>
+        SAL_CALL getParaAfter(const Reference<text::XFlatParagraph>&) override
+    {
+        return nullptr;
+    }
+};
+
+class TestGrammarCheckingIterator : public test::BootstrapFixtureBase
+{
+public:
+    virtual void setUp() override;
+    virtual void tearDown() override;
+
+private:
+    CPPUNIT_TEST_SUITE(TestGrammarCheckingIterator);
+    CPPUNIT_TEST(testDisposeWhileQueued);
+    CPPUNIT_TEST_SUITE_END();
+
+    void testDisposeWhileQueued();
+
+    Reference<linguistic2::XProofreadingIterator> m_xIterator;
+};
+
+void TestGrammarCheckingIterator::setUp()
+{
+    test::BootstrapFixtureBase::setUp();
+
+    m_xIterator = linguistic2::ProofreadingIterator::create(m_xContext);
+}
+
+void TestGrammarCheckingIterator::tearDown()
+{
+    // ends the checking thread
+    Reference<lang::XComponent>(m_xIterator, UNO_QUERY_THROW)->dispose();
+    m_xIterator.clear();
+
+    test::BootstrapFixtureBase::tearDown();
+}
+
+void TestGrammarCheckingIterator::testDisposeWhileQueued()
+{
+    rtl::Reference<MockFlatParagraph> xBusyPara(new MockFlatParagraph(u"Busy."_ustr, true));
+    rtl::Reference<MockFlatParagraph> xDroppedPara(new MockFlatParagraph(u"Dropped."_ustr, false));
+    rtl::Reference<MockFlatParagraph> xKeptPara(new MockFlatParagraph(u"Kept."_ustr, false));
+    rtl::Reference<MockDocument> xBusyDoc(new MockDocument(xBusyPara));
+    rtl::Reference<MockDocument> xDroppedDoc(new MockDocument(xDroppedPara));
+    rtl::Reference<MockDocument> xKeptDoc(new MockDocument(xKeptPara));
+
+    // keep the checking thread busy with the first document while the others queue up
+    m_xIterator->startProofreading(xBusyDoc->getXWeak(), xBusyDoc);
+    CPPUNIT_ASSERT(xBusyPara->WaitReached());
+    m_xIterator->startProofreading(xDroppedDoc->getXWeak(), xDroppedDoc);
+    m_xIterator->startProofreading(xKeptDoc->getXWeak(), xKeptDoc);
+
+    // the entries of a disposed document are dropped, the other ones are still checked
+    xDroppedDoc->dispose();
+    xBusyPara->Release();
+    CPPUNIT_ASSERT(xBusyPara->WaitChecked());
+    CPPUNIT_ASSERT(xKeptPara->WaitChecked());
+    CPPUNIT_ASSERT_EQUAL(sal_Int32(1), xKeptPara->GetTextCalls());
+    CPPUNIT_ASSERT_EQUAL(sal_Int32(0), xDroppedPara->GetTextCalls());
+
+    // documents started afterwards are checked as well
+    rtl::Reference<MockFlatParagraph> xLaterPara(new MockFlatParagraph(u"Later."_ustr, false));
+    rtl::Reference<MockDocument> xLaterDoc(new MockDocument(xLaterPara));
+    m_xIterator->startProofreading(xLaterDoc->getXWeak(), xLaterDoc);
+    CPPUNIT_ASSERT(xLaterPara->WaitChecked());
+}
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestGrammarCheckingIterator);
+}
+
+CPPUNIT_PLUGIN_IMPLEMENT();
+
+/* vim:set shiftwidth=4 softtabstop=4 expandtab: */
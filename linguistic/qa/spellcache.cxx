@@ -0,0 +1,272 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+/*
+ * This file is part of the LibreOffice project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <sal/config.h>
+
+#include <com/sun/star/beans/PropertyValue.hpp>
+#include <com/sun/star/container/XSet.hpp>
+#include <com/sun/star/lang/XServiceInfo.hpp>
+#include <com/sun/star/lang/XSingleComponentFactory.hpp>
+#include <com/sun/star/linguistic2/DictionaryList.hpp>
+#include <com/sun/star/linguistic2/DictionaryType.hpp>
+#include <com/sun/star/linguistic2/LinguServiceManager.hpp>
+#include <com/sun/star/linguistic2/XDictionary.hpp>
+#include <com/sun/star/linguistic2/XSpellChecker.hpp>
+#include <cppuhelper/implbase.hxx>
+#include <cppuhelper/supportsservice.hxx>
+#include <i18nlangtag/lang.h>
+#include <linguistic/misc.hxx>
+#include <rtl/ref.hxx>
+#include <unotest/bootstrapfixturebase.hxx>
+
+#include <iprcache.hxx>
+
+#include <algorithm>
+#include <initializer_list>
+#include <optional>
+#include <vector>
+
+using namespace ::com::sun::star;
+using namespace ::com::sun::star::uno;
+
+namespace
+{
+/// Spell checker service with a fixed verdict that counts how often it is asked.
+class MockSpellChecker
+    : public cppu::WeakImplHelper<linguistic2::XSpellChecker, lang::XServiceInfo,
+                                  lang::XSingleComponentFactory>
+{
+    OUString m_aImplName;
+    bool m_bAccept;
+    sal_Int32 m_nCalls;
+
+public:
+    MockSpellChecker(const OUString& rImplName, bool bAccept)
+        : m_aImplName(rImplName)
+        , m_bAccept(bAccept)
+        , m_nCalls(0)
+    {
+    }
+
+    sal_Int32 GetCalls() const { return m_nCalls; }
+
+    // XSupportedLocales
+    virtual Sequence<lang::Locale> SAL_CALL getLocales() override
+    {
+        return { lang::Locale(u"en"_ustr, u"US"_ustr, OUString()) };
+    }
+    virtual sal_Bool SAL_CALL hasLocale(const lang::Locale& rLocale) override
+    {
+        return rLocale.Language == "en" && rLocale.Country == "US";
+    }
+
+    // XSpellChecker
+    virtual sal_Bool SAL_CALL isValid(const OUString&, const lang::Locale&,
+                                      const Sequence<beans::PropertyValue>&) override
+    {
+        ++m_nCalls;
+        return m_bAccept;
+    }
+    virtual Reference<linguistic2::XSpellAlternatives>
+        SAL_CALL spell(const OUString&, const lang::Locale&,
+                       const Sequence<beans::PropertyValue>&) override
+    {
+        return nullptr;
+    }
+
+    // XServiceInfo
+    virtual OUString SAL_CALL getImplementationName() override { return m_aImplName; }
+    virtual sal_Bool SAL_CALL supportsService(const OUString& rServiceName) override
+    {
+        return cppu::supportsService(this, rServiceName);
+    }
+    virtual Sequence<OUString> SAL_CALL getSupportedServiceNames() override
+    {
+        return { m_aImplName };
+    }
+
+    // XSingleComponentFactory, the service manager hands out this very instance
+    virtual Reference<XInterface>
+        SAL_CALL createInstanceWithContext(const Reference<XComponentContext>&) override
+    {
+        return static_cast<linguistic2::XSpellChecker*>(this);
+    }
+    virtual Reference<XInterface> SAL_CALL createInstanceWithArgumentsAndContext(
+        const Sequence<Any>&, const Reference<XComponentContext>&) override
+    {
+        return static_cast<linguistic2::XSpellChecker*>(this);
+    }
+};
+
+class TestSpellCache : public test::BootstrapFixtureBase
+{
+public:
+    virtual void setUp() override;
+    virtual void tearDown() override;
+
+private:
+    CPPUNIT_TEST_SUITE(TestSpellCache);
+    CPPUNIT_TEST(testPreviousGeneration);
+    CPPUNIT_TEST(testFlushOnAddPosEntry);
+    CPPUNIT_TEST(testMisspelledAfterAllServices);
+    CPPUNIT_TEST(testMisspelledWithProperties);
+    CPPUNIT_TEST_SUITE_END();
+
+    void testPreviousGeneration();
+    void testFlushOnAddPosEntry();
+    void testMisspelledAfterAllServices();
+    void testMisspelledWithProperties();
+
+    void setServices(std::initializer_list<rtl::Reference<MockSpellChecker>> aServices);
+
+    lang::Locale m_aLocale;
+    Reference<linguistic2::XLinguServiceManager2> m_xLngSvcMgr;
+    Sequence<OUString> m_aOrigServices;
+    std::vector<rtl::Reference<MockSpellChecker>> m_aServices;
+};
+
+void TestSpellCache::setUp()
+{
+    test::BootstrapFixtureBase::setUp();
+
+    m_aLocale = lang::Locale(u"en"_ustr, u"US"_ustr, OUString());
+    m_xLngSvcMgr = linguistic2::LinguServiceManager::create(m_xContext);
+    m_aOrigServices = m_xLngSvcMgr->getConfiguredServices(SN_SPELLCHECKER, m_aLocale);
+}
+
+void TestSpellCache::tearDown()
+{
+    // also flushes the dispatcher's cache and drops its references to the mock services
+    m_xLngSvcMgr->setConfiguredServices(SN_SPELLCHECKER, m_aLocale, m_aOrigServices);
+    Reference<container::XSet> xSet(m_xContext->getServiceManager(), UNO_QUERY_THROW);
+    for (const rtl::Reference<MockSpellChecker>& rService : m_aServices)
+        xSet->remove(Any(Reference<lang::XServiceInfo>(rService)));
+    m_aServices.clear();
+    m_xLngSvcMgr.clear();
+
+    test::BootstrapFixtureBase::tearDown();
+}
+
+void TestSpellCache::setServices(std::initializer_list<rtl::Reference<MockSpellChecker>> aServices)
+{
+    Reference<container::XSet> xSet(m_xContext->getServiceManager(), UNO_QUERY_THROW);
+    Sequence<OUString> aImplNames(aServices.size());
+    OUString* pImplNames = aImplNames.getArray();
+    for (const rtl::Reference<MockSpellChecker>& rService : aServices)
+    {
+        if (std::find(m_aServices.begin(), m_aServices.end(), rService) == m_aServices.end())
+        {
+            xSet->insert(Any(Reference<lang::XServiceInfo>(rService)));
+            m_aServices.push_back(rService);
+        }
+        *pImplNames++ = rService->getImplementationName();
+    }
+    m_xLngSvcMgr->setConfiguredServices(SN_SPELLCHECKER, m_aLocale, aImplNames);
+}
+
+void TestSpellCache::testPreviousGeneration()
+{
+    linguistic::SpellCache aCache(2);
+    aCache.AddWord(u"one"_ustr, LANGUAGE_ENGLISH_US);
+    aCache.AddWord(u"two"_ustr, LANGUAGE_ENGLISH_US, false);
+    // the current generation is full, "one" and "two" become the previous one
+    aCache.AddWord(u"three"_ustr, LANGUAGE_ENGLISH_US);
+
+    // a hit in the previous generation moves the word back into the current one
+    CPPUNIT_ASSERT(aCache.LookUpWord(u"one"_ustr, LANGUAGE_ENGLISH_US) == std::optional<bool>(true));
+    // "three" and "one" become the previous generation, "two" is dropped
+    aCache.AddWord(u"four"_ustr, LANGUAGE_ENGLISH_US);
+
+    CPPUNIT_ASSERT(aCache.LookUpWord(u"one"_ustr, LANGUAGE_ENGLISH_US) == std::optional<bool>(true));
+    CPPUNIT_ASSERT(aCache.LookUpWord(u"three"_ustr, LANGUAGE_ENGLISH_US) == std::optional<bool>(true));
+    CPPUNIT_ASSERT(!aCache.LookUpWord(u"two"_ustr, LANGUAGE_ENGLISH_US).has_value());
+    // words are kept per language
+    CPPUNIT_ASSERT(!aCache.LookUpWord(u"four"_ustr, LANGUAGE_GERMAN).has_value());
+    CPPUNIT_ASSERT_EQUAL(sal_uInt64(3), aCache.GetHits());
+    CPPUNIT_ASSERT_EQUAL(sal_uInt64(2), aCache.GetMisses());
+}
+
+void TestSpellCache::testFlushOnAddPosEntry()
+{
+    Reference<linguistic2::XSearchableDictionaryList> xDicList(
+        linguistic2::DictionaryList::create(m_xContext));
+    Reference<linguistic2::XDictionary> xDic(xDicList->createDictionary(
+        u"spellcache_test.dic"_ustr, m_aLocale, linguistic2::DictionaryType_POSITIVE, OUString()));
+    CPPUNIT_ASSERT(xDic.is());
+    xDicList->addDictionary(xDic);
+    xDic->setActive(true);
+
+    linguistic::SpellCache aCache;
+    aCache.AddWord(u"Frobnicate"_ustr, LANGUAGE_ENGLISH_US, false);
+    CPPUNIT_ASSERT(aCache.LookUpWord(u"Frobnicate"_ustr, LANGUAGE_ENGLISH_US) == std::optional<bool>(false));
+
+    // the misspelled verdict is outdated once the word is in an active positive dictionary
+    xDic->add(u"Frobnicate"_ustr, false, OUString());
+    CPPUNIT_ASSERT(!aCache.LookUpWord(u"Frobnicate"_ustr, LANGUAGE_ENGLISH_US).has_value());
+
+    xDicList->removeDictionary(xDic);
+}
+
+void TestSpellCache::testMisspelledAfterAllServices()
+{
+    rtl::Reference<MockSpellChecker> xReject(
+        new MockSpellChecker(u"org.libreoffice.test.RejectingSpellChecker"_ustr, false));
+    rtl::Reference<MockSpellChecker> xAccept(
+        new MockSpellChecker(u"org.libreoffice.test.AcceptingSpellChecker"_ustr, true));
+    setServices({ xReject, xAccept });
+    Reference<linguistic2::XSpellChecker> xSpell(m_xLngSvcMgr->getSpellChecker());
+
+    // the rejection of the first service is not remembered, the second one accepts the word
+    CPPUNIT_ASSERT(xSpell->isValid(u"qwertz"_ustr, m_aLocale, {}));
+    CPPUNIT_ASSERT_EQUAL(sal_Int32(1), xReject->GetCalls());
+    CPPUNIT_ASSERT_EQUAL(sal_Int32(1), xAccept->GetCalls());
+    CPPUNIT_ASSERT(xSpell->isValid(u"qwertz"_ustr, m_aLocale, {}));
+    CPPUNIT_ASSERT_EQUAL(sal_Int32(1), xReject->GetCalls());
+    CPPUNIT_ASSERT_EQUAL(sal_Int32(1), xAccept->GetCalls());
+
+    // once every service rejected a word it is not asked about it again
+    rtl::Reference<MockSpellChecker> xReject2(
+        new MockSpellChecker(u"org.libreoffice.test.RejectingSpellChecker2"_ustr, false));
+    setServices({ xReject, xReject2 });
+    CPPUNIT_ASSERT(!xSpell->isValid(u"qwertz"_ustr, m_aLocale, {}));
+    CPPUNIT_ASSERT_EQUAL(sal_Int32(2), xReject->GetCalls());
+    CPPUNIT_ASSERT_EQUAL(sal_Int32(1), xReject2->GetCalls());
+    CPPUNIT_ASSERT(!xSpell->isValid(u"qwertz"_ustr, m_aLocale, {}));
+    CPPUNIT_ASSERT_EQUAL(sal_Int32(2), xReject->GetCalls());
+    CPPUNIT_ASSERT_EQUAL(sal_Int32(1), xReject2->GetCalls());
+}
+
+void TestSpellCache::testMisspelledWithProperties()
+{
+    rtl::Reference<MockSpellChecker> xReject(
+        new MockSpellChecker(u"org.libreoffice.test.RejectingSpellChecker"_ustr, false));
+    setServices({ xReject });
+    Reference<linguistic2::XSpellChecker> xSpell(m_xLngSvcMgr->getSpellChecker());
+    const Sequence<beans::PropertyValue> aProperties{ beans::PropertyValue(
+        u"IsSpellWithDigits"_ustr, -1, Any(true), beans::PropertyState_DIRECT_VALUE) };
+
+    // a verdict for temporary settings is not remembered
+    CPPUNIT_ASSERT(!xSpell->isValid(u"asdfgh"_ustr, m_aLocale, aProperties));
+    CPPUNIT_ASSERT(!xSpell->isValid(u"asdfgh"_ustr, m_aLocale, aProperties));
+    CPPUNIT_ASSERT_EQUAL(sal_Int32(2), xReject->GetCalls());
+
+    // one without is, but not used with temporary settings, which may accept the word
+    CPPUNIT_ASSERT(!xSpell->isValid(u"asdfgh"_ustr, m_aLocale, {}));
+    CPPUNIT_ASSERT(!xSpell->isValid(u"asdfgh"_ustr, m_aLocale, {}));
+    CPPUNIT_ASSERT_EQUAL(sal_Int32(3), xReject->GetCalls());
+    CPPUNIT_ASSERT(!xSpell->isValid(u"asdfgh"_ustr, m_aLocale, aProperties));
+    CPPUNIT_ASSERT_EQUAL(sal_Int32(4), xReject->GetCalls());
+}
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestSpellCache);
+}
+
+CPPUNIT_PLUGIN_IMPLEMENT();
+
+/* vim:set shiftwidth=4 softtabstop=4 expandtab: */
@@ -375,13 +375,45 @@ void GrammarCheckingIterator::AddEntry(
     ::osl::Guard< ::osl::Mutex > aGuard( MyMutex() );
     if (!m_thread)
         m_thread = osl_createThread( lcl_workerfunc, this );
-    m_aFPEntriesQueue.push_back( aNewFPEntry );
+    FPQueue_t &rQueue = m_aFPEntriesQueues[ rDocId ];
+    if (rQueue.empty())
+        m_aDocIdTurns.push_back( rDocId );
+    rQueue.push_back( aNewFPEntry );
 
     // wake up the thread in order to do grammar checking
     m_aWakeUpThread.set();
 }
 
 
+bool GrammarCheckingIterator::TakeNextEntry( FPEntry &rEntry )
+{
+    // take the first entry of the document whose turn it is, and let that
+    // document queue up again behind the others if it has more entries
+    while (!m_aDocIdTurns.empty())
+    {
+        OUString aDocId = m_aDocIdTurns.front();
+        m_aDocIdTurns.pop_front();
+        const FPQueuesByDoc_t::iterator aIt( m_aFPEntriesQueues.find( aDocId ) );
+        if (aIt == m_aFPEntriesQueues.end() || aIt->second.empty())
+        {
+            // should not happen, disposing() drops the turns along with the queue
+            SAL_WARN( "linguistic", "no queued entries for document " << aDocId );
+            if (aIt != m_aFPEntriesQueues.end())
+                m_aFPEntriesQueues.erase( aIt );
+            continue;
+        }
+        rEntry = std::move( aIt->second.front() );
+        aIt->second.pop_front();
+        if (aIt->second.empty())
+            m_aFPEntriesQueues.erase( aIt );
+        else
+            m_aDocIdTurns.push_back( std::move( aDocId ) );
+        return true;
+    }
+    return false;
+}
+
+
 void GrammarCheckingIterator::ProcessResult(
     const linguistic2::ProofreadingResult &rRes,
     const uno::Reference< text::XFlatParagraphIterator > &rxFlatParagraphIterator,
@@ -613,37 +645,33 @@ void GrammarCheckingIterator::DequeueAndCheck()
 {
     for (;;)
     {
+        uno::Reference< text::XFlatParagraphIterator > xFPIterator;
+        uno::Reference< text::XFlatParagraph > xFlatPara;
+        FPEntry aFPEntryItem;
+        OUString aCurDocId;
         // ---- THREAD SAFE START ----
         bool bQueueEmpty = false;
         {
+            // check and take in one go: disposing() may drop the entries
+            // of a document at any time in between
             ::osl::Guard< ::osl::Mutex > aGuard( MyMutex() );
             if (m_bEnd)
             {
                 break;
             }
-            bQueueEmpty = m_aFPEntriesQueue.empty();
-        }
-        // ---- THREAD SAFE END ----
-
-        if (!bQueueEmpty)
-        {
-            uno::Reference< text::XFlatParagraphIterator > xFPIterator;
-            uno::Reference< text::XFlatParagraph > xFlatPara;
-            FPEntry aFPEntryItem;
-            OUString aCurDocId;
-            // ---- THREAD SAFE START ----
+            bQueueEmpty = !TakeNextEntry( aFPEntryItem );
+            if (!bQueueEmpty)
             {
-                ::osl::Guard< ::osl::Mutex > aGuard( MyMutex() );
-                aFPEntryItem        = m_aFPEntriesQueue.front();
                 xFPIterator         = aFPEntryItem.m_xParaIterator;
                 xFlatPara           = aFPEntryItem.m_xPara;
                 m_aCurCheckedDocId  = aFPEntryItem.m_aDocId;
                 aCurDocId = m_aCurCheckedDocId;
-
-                m_aFPEntriesQueue.pop_front();
             }
-            // ---- THREAD SAFE END ----
+        }
+        // ---- THREAD SAFE END ----
 
+        if (!bQueueEmpty)
+        {
             if (xFlatPara.is() && xFPIterator.is())
             {
                 try
@@ -743,7 +771,7 @@ void GrammarCheckingIterator::DequeueAndCheck()
                     break;
                 }
                 // Check queue state again
-                if (m_aFPEntriesQueue.empty())
+                if (m_aDocIdTurns.empty())
                     m_aWakeUpThread.reset();
             }
             // ---- THREAD SAFE END ----
@@ -950,13 +978,7 @@ sal_Bool SAL_CALL GrammarCheckingIterator::isProofreading(
             {
                 // we need to check if there is an entry for that document in the queue...
                 // That is the document is going to be checked sooner or later.
-
-                sal_Int32 nSize = m_aFPEntriesQueue.size();
-                for (sal_Int32 i = 0; i < nSize && !bRes; ++i)
-                {
-                    if (aDocId == m_aFPEntriesQueue[i].m_aDocId)
-                        bRes = true;
-                }
+                bRes = m_aFPEntriesQueues.contains( aDocId );
             }
         }
     }
@@ -1032,10 +1054,11 @@ void SAL_CALL GrammarCheckingIterator::dispose()
         // clear containers with UNO references AND have those references released
         GCReferences_t  aTmpEmpty1;
         DocMap_t        aTmpEmpty2;
-        FPQueue_t       aTmpEmpty3;
+        FPQueuesByDoc_t aTmpEmpty3;
         m_aGCReferencesByService.swap( aTmpEmpty1 );
         m_aDocIdMap.swap( aTmpEmpty2 );
-        m_aFPEntriesQueue.swap( aTmpEmpty3 );
+        m_aFPEntriesQueues.swap( aTmpEmpty3 );
+        m_aDocIdTurns.clear();
     }
     // ---- THREAD SAFE END ----
 }
@@ -1064,19 +1087,25 @@ void SAL_CALL GrammarCheckingIterator::removeEventListener(
 void SAL_CALL GrammarCheckingIterator::disposing( const lang::EventObject &rSource )
 {
     // if the component (document) is disposing release all references
-    //!! There is no need to remove entries from the queue that are from this document
-    //!! since the respectives xFlatParagraphs should become invalid (isModified() == true)
-    //!! and the call to xFlatParagraphIterator->getNextPara() will result in an empty reference.
-    //!! And if an entry is currently checked by a grammar checker upon return the results
-    //!! should be ignored.
+    //!! The entries still queued for this document are dropped as well, there is no
+    //!! point in asking the flat paragraphs of a disposed document whether they changed.
+    //!! If an entry is currently checked by a grammar checker upon return the results
+    //!! should be ignored, since the respective xFlatParagraph should become invalid
+    //!! (isModified() == true) and the call to xFlatParagraphIterator->getNextPara()
+    //!! will result in an empty reference.
     //!! Also GetOrCreateDocId will not use that very same Id again...
-    //!! All of the above resulting in that we only have to get rid of the implementation pointer here.
     uno::Reference< lang::XComponent > xDoc( rSource.Source, uno::UNO_QUERY );
     if (xDoc.is())
     {
         // ---- THREAD SAFE START ----
         ::osl::Guard< ::osl::Mutex > aGuard( MyMutex() );
-        m_aDocIdMap.erase( xDoc.get() );
+        const DocMap_t::iterator aIt( m_aDocIdMap.find( xDoc.get() ) );
+        if (aIt != m_aDocIdMap.end())
+        {
+            if (m_aFPEntriesQueues.erase( aIt->second ))
+                std::erase( m_aDocIdTurns, aIt->second );
+            m_aDocIdMap.erase( aIt );
+        }
         // ---- THREAD SAFE END ----
     }
 }
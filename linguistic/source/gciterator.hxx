@@ -88,8 +88,13 @@ class GrammarCheckingIterator:
     //every element of this queue is a FlatParagraphEntry struct-object
     typedef std::deque< FPEntry > FPQueue_t;
 
-    // queue for entries to be processed
-    FPQueue_t       m_aFPEntriesQueue;
+    // queues for entries to be processed, one per document
+    typedef std::map< OUString, FPQueue_t > FPQueuesByDoc_t;
+    FPQueuesByDoc_t m_aFPEntriesQueues;
+
+    // ids of the documents with entries to be processed, in the order they get
+    // their turn, so a large document does not keep the others waiting
+    std::deque< OUString > m_aDocIdTurns;
 
     // the flag to end the endless loop
     bool        m_bEnd;
@@ -130,6 +135,9 @@ class GrammarCheckingIterator:
             const css::uno::Reference< css::text::XFlatParagraphIterator >& xFlatParaIterator,
             const css::uno::Reference< css::text::XFlatParagraph >& xFlatPara,
             const OUString &rDocId, sal_Int32 nStartIndex, bool bAutomatic );
+    // Precondition: MyMutex() is locked.
+    // Returns false if there are no entries to be processed.
+    bool TakeNextEntry( FPEntry &rEntry );
 
     void ProcessResult( const css::linguistic2::ProofreadingResult &rRes,
             const css::uno::Reference< css::text::XFlatParagraphIterator > &rxFlatParagraphIterator,
@@ -23,6 +23,7 @@
 
 #include <com/sun/star/linguistic2/DictionaryListEventFlags.hpp>
 #include <osl/mutex.hxx>
+#include <sal/log.hxx>
 #include <unotools/linguprops.hxx>
 
 using namespace osl;
@@ -155,10 +156,14 @@ void SAL_CALL FlushListener::processDictionaryListEvent(
 
     sal_Int16 nEvt = rDicListEvent.nCondensedEvent;
     sal_Int16 const nFlushFlags =
+            DictionaryListEventFlags::ADD_POS_ENTRY     |
             DictionaryListEventFlags::ADD_NEG_ENTRY     |
             DictionaryListEventFlags::DEL_POS_ENTRY     |
+            DictionaryListEventFlags::DEL_NEG_ENTRY     |
+            DictionaryListEventFlags::ACTIVATE_POS_DIC  |
             DictionaryListEventFlags::ACTIVATE_NEG_DIC  |
-            DictionaryListEventFlags::DEACTIVATE_POS_DIC;
+            DictionaryListEventFlags::DEACTIVATE_POS_DIC |
+            DictionaryListEventFlags::DEACTIVATE_NEG_DIC;
     bool bFlush = 0 != (nEvt & nFlushFlags);
 
     if (bFlush)
@@ -181,7 +186,10 @@ void SAL_CALL FlushListener::propertyChange(
 }
 
 
-SpellCache::SpellCache()
+SpellCache::SpellCache( size_t nCapacity )
+    : mnCapacity( nCapacity )
+    , mnHits( 0 )
+    , mnMisses( 0 )
 {
     mxFlushLstnr = new FlushListener( *this );
     Reference<XSearchableDictionaryList> aDictionaryList(GetDictionaryList());
@@ -201,26 +209,50 @@ SpellCache::~SpellCache()
 void SpellCache::Flush()
 {
     MutexGuard  aGuard( GetLinguMutex() );
+    SAL_INFO("linguistic", "spell cache flushed, " << mnHits << " hits, " << mnMisses << " misses");
     // clear word list
     LangWordList_t().swap(aWordLists);
 }
 
-bool SpellCache::CheckWord( const OUString& rWord, LanguageType nLang )
+std::optional<bool> SpellCache::LookUpWord( const OUString& rWord, LanguageType nLang )
 {
     MutexGuard  aGuard( GetLinguMutex() );
-    WordList_t &rList = aWordLists[ nLang ];
-    const WordList_t::const_iterator aIt = rList.find( rWord );
-    return aIt != rList.end();
+    const LangWordList_t::iterator aLangIt = aWordLists.find( nLang );
+    if (aLangIt != aWordLists.end())
+    {
+        WordLists_t &rLists = aLangIt->second;
+        WordList_t::const_iterator aIt = rLists.aCurrent.find( rWord );
+        if (aIt != rLists.aCurrent.end())
+        {
+            ++mnHits;
+            return aIt->second;
+        }
+        aIt = rLists.aPrevious.find( rWord );
+        if (aIt != rLists.aPrevious.end())
+        {
+            ++mnHits;
+            const bool bCorrect = aIt->second;
+            // still in use, keep it for the next generation
+            rLists.aPrevious.erase( aIt );
+            AddWord( rWord, nLang, bCorrect );
+            return bCorrect;
+        }
+    }
+    ++mnMisses;
+    return {};
 }
 
-void SpellCache::AddWord( const OUString& rWord, LanguageType nLang )
+void SpellCache::AddWord( const OUString& rWord, LanguageType nLang, bool bCorrect )
 {
     MutexGuard  aGuard( GetLinguMutex() );
-    WordList_t & rList = aWordLists[ nLang ];
+    WordLists_t & rLists = aWordLists[ nLang ];
     // occasional clean-up...
-    if (rList.size() > 500)
-        rList.clear();
-    rList.insert( rWord );
+    if (rLists.aCurrent.size() >= mnCapacity)
+    {
+        rLists.aPrevious.swap( rLists.aCurrent );
+        rLists.aCurrent.clear();
+    }
+    rLists.aCurrent[ rWord ] = bCorrect;
 }
 
 }   // namespace linguistic
@@ -285,113 +285,111 @@ bool SpellCheckerDispatcher::isValid_Impl(
         if (IsIgnoreControlChars( rProperties, GetPropSet() ))
             RemoveControlChars( aChkWord );
 
-        sal_Int32 nLen = pEntry->aSvcRefs.getLength();
-        DBG_ASSERT( nLen == pEntry->aSvcImplNames.getLength(),
-                "lng : sequence length mismatch");
-        DBG_ASSERT( pEntry->nLastTriedSvcIndex < nLen,
-                "lng : index out of range");
-
-        sal_Int32 i = 0;
-        bool bTmpRes = true;
-        bool bTmpResValid = false;
-
-        // try already instantiated services first
+        // Correct words are remembered independent of the settings, misspelled
+        // ones only if no temporary settings are supplied.
+        std::optional<bool> oCached = GetCache().LookUpWord( aChkWord, nLanguage );
+        if (oCached && (*oCached || !rProperties.hasElements()))
+            bRes = *oCached;
+        else
         {
-            const Reference< XSpellChecker >  *pRef  =
-                    pEntry->aSvcRefs.getConstArray();
-            while (i <= pEntry->nLastTriedSvcIndex
-                   && (!bTmpResValid || !bTmpRes))
+            sal_Int32 nLen = pEntry->aSvcRefs.getLength();
+            DBG_ASSERT( nLen == pEntry->aSvcImplNames.getLength(),
+                    "lng : sequence length mismatch");
+            DBG_ASSERT( pEntry->nLastTriedSvcIndex < nLen,
+                    "lng : index out of range");
+
+            sal_Int32 i = 0;
+            bool bTmpRes = true;
+            bool bTmpResValid = false;
+            bool bAnyResValid = false;
+
+            // try already instantiated services first
             {
-                bTmpResValid = true;
-                if (pRef[i].is()  &&  pRef[i]->hasLocale( aLocale ))
+                const Reference< XSpellChecker >  *pRef  =
+                        pEntry->aSvcRefs.getConstArray();
+                while (i <= pEntry->nLastTriedSvcIndex
+                       && (!bTmpResValid || !bTmpRes))
                 {
-                    bTmpRes = GetCache().CheckWord( aChkWord, nLanguage );
-                    if (!bTmpRes)
-                    {
+                    bTmpResValid = true;
+                    if (pRef[i].is()  &&  pRef[i]->hasLocale( aLocale ))
                         bTmpRes = pRef[i]->isValid( aChkWord, aLocale, rProperties );
+                    else
+                        bTmpResValid = false;
 
-                        // Add correct words to the cache.
-                        // But not those that are correct only because of
-                        // the temporary supplied settings.
-                        if (bTmpRes  &&  !rProperties.hasElements())
-                            GetCache().AddWord( aChkWord, nLanguage );
+                    if (bTmpResValid)
+                    {
+                        bRes = bTmpRes;
+                        bAnyResValid = true;
                     }
-                }
-                else
-                    bTmpResValid = false;
-
-                if (bTmpResValid)
-                    bRes = bTmpRes;
 
-                ++i;
+                    ++i;
+                }
             }
-        }
 
-        // if still no result instantiate new services and try those
-        if ((!bTmpResValid || !bTmpRes)
-            &&  pEntry->nLastTriedSvcIndex < nLen - 1)
-        {
-            const OUString *pImplNames = pEntry->aSvcImplNames.getConstArray();
-            Reference< XSpellChecker >  *pRef  = pEntry->aSvcRefs .getArray();
+            // if still no result instantiate new services and try those
+            if ((!bTmpResValid || !bTmpRes)
+                &&  pEntry->nLastTriedSvcIndex < nLen - 1)
+            {
+                const OUString *pImplNames = pEntry->aSvcImplNames.getConstArray();
+                Reference< XSpellChecker >  *pRef  = pEntry->aSvcRefs .getArray();
 
-            const Reference< XComponentContext >& xContext(
-                comphelper::getProcessComponentContext() );
+                const Reference< XComponentContext >& xContext(
+                    comphelper::getProcessComponentContext() );
 
-            // build service initialization argument
-            Sequence< Any > aArgs(2);
-            aArgs.getArray()[0] <<= GetPropSet();
+                // build service initialization argument
+                Sequence< Any > aArgs(2);
+                aArgs.getArray()[0] <<= GetPropSet();
 
-            while (i < nLen && (!bTmpResValid || !bTmpRes))
-            {
-                // create specific service via it's implementation name
-                Reference< XSpellChecker > xSpell;
-                try
-                {
-                    xSpell.set( xContext->getServiceManager()->createInstanceWithArgumentsAndContext(
-                                    pImplNames[i], aArgs, xContext ),
-                                UNO_QUERY );
-                }
-                catch (uno::Exception &)
+                while (i < nLen && (!bTmpResValid || !bTmpRes))
                 {
-                    SAL_WARN( "linguistic", "createInstanceWithArguments failed" );
-                }
-                pRef [i] = xSpell;
+                    // create specific service via it's implementation name
+                    Reference< XSpellChecker > xSpell;
+                    try
+                    {
+                        xSpell.set( xContext->getServiceManager()->createInstanceWithArgumentsAndContext(
+                                        pImplNames[i], aArgs, xContext ),
+                                    UNO_QUERY );
+                    }
+                    catch (uno::Exception &)
+                    {
+                        SAL_WARN( "linguistic", "createInstanceWithArguments failed" );
+                    }
+                    pRef [i] = xSpell;
 
-                Reference< XLinguServiceEventBroadcaster >
-                        xBroadcaster( xSpell, UNO_QUERY );
-                if (xBroadcaster.is())
-                    m_rMgr.AddLngSvcEvtBroadcaster( xBroadcaster );
+                    Reference< XLinguServiceEventBroadcaster >
+                            xBroadcaster( xSpell, UNO_QUERY );
+                    if (xBroadcaster.is())
+                        m_rMgr.AddLngSvcEvtBroadcaster( xBroadcaster );
 
-                bTmpResValid = true;
-                if (xSpell.is()  &&  xSpell->hasLocale( aLocale ))
-                {
-                    bTmpRes = GetCache().CheckWord( aChkWord, nLanguage );
-                    if (!bTmpRes)
-                    {
+                    bTmpResValid = true;
+                    if (xSpell.is()  &&  xSpell->hasLocale( aLocale ))
                         bTmpRes = xSpell->isValid( aChkWord, aLocale, rProperties );
-                         // Add correct words to the cache.
-                        // But not those that are correct only because of
-                        // the temporary supplied settings.
-                        if (bTmpRes  &&  !rProperties.hasElements())
-                            GetCache().AddWord( aChkWord, nLanguage );
+                    else
+                        bTmpResValid = false;
+                    if (bTmpResValid)
+                    {
+                        bRes = bTmpRes;
+                        bAnyResValid = true;
                     }
+
+                    pEntry->nLastTriedSvcIndex = static_cast<sal_Int16>(i);
+                    ++i;
                 }
-                else
-                    bTmpResValid = false;
-                if (bTmpResValid)
-                    bRes = bTmpRes;
 
-                pEntry->nLastTriedSvcIndex = static_cast<sal_Int16>(i);
-                ++i;
+                // if language is not supported by any of the services
+                // remove it from the list.
+                if (i == nLen)
+                {
+                    if (!SvcListHasLanguage( *pEntry, nLanguage ))
+                        m_aSvcMap.erase( nLanguage );
+                }
             }
 
-            // if language is not supported by any of the services
-            // remove it from the list.
-            if (i == nLen)
-            {
-                if (!SvcListHasLanguage( *pEntry, nLanguage ))
-                    m_aSvcMap.erase( nLanguage );
-            }
+            // Add the verdict of the services to the cache, misspelled words only
+            // once all services have rejected them. But not those that are correct
+            // only because of the temporary supplied settings.
+            if (bAnyResValid  &&  (bRes || i == nLen)  &&  !rProperties.hasElements())
+                GetCache().AddWord( aChkWord, nLanguage, bRes );
         }
 
         // cross-check against results from dictionaries which have precedence!
@@ -53,7 +53,7 @@ class SpellCheckerDispatcher :
     css::uno::Reference< css::linguistic2::XSearchableDictionaryList >  m_xDicList;
 
     LngSvcMgr                       &m_rMgr;
-    mutable std::unique_ptr<linguistic::SpellCache> m_pCache; // Spell Cache (holds known words)
+    mutable std::unique_ptr<linguistic::SpellCache> m_pCache; // Spell Cache (holds verdicts of known words)
     std::optional<CharClass>       m_oCharClass;
 
     SpellCheckerDispatcher(const SpellCheckerDispatcher &) = delete;
@@ -56,6 +56,8 @@ inline constexpr sal_Int32 n_ConstDigestDecrypt = 1056; // 1024 + 32
 inline constexpr OUString ENCRYPTION_KEY_PROPERTY = u"EncryptionKey"_ustr;
 inline constexpr OUString STORAGE_ENCRYPTION_KEYS_PROPERTY = u"StorageEncryptionKeys"_ustr;
 inline constexpr OUString ENCRYPTION_ALGORITHMS_PROPERTY = u"EncryptionAlgorithms"_ustr;
+// deflated data of an unencrypted package member, see ZipPackageStream::getPropertyValue()
+inline constexpr OUString RAW_DEFLATED_DATA_PROPERTY = u"RawDeflatedData"_ustr;
 inline constexpr OUString ENCRYPTION_GPG_PROPERTIES = u"EncryptionGpGProperties"_ustr;
 #define HAS_ENCRYPTED_ENTRIES_PROPERTY "HasEncryptedEntries"
 #define HAS_NONENCRYPTED_ENTRIES_PROPERTY "HasNonEncryptedEntries"
@@ -78,11 +78,21 @@ private:
     bool m_bUseWinEncoding;
     bool m_bRawStream;
 
+    /// already deflated data of an unchanged stream copied over from another package,
+    /// written as is instead of deflating m_xStream again
+    css::uno::Reference< css::io::XInputStream > m_xRawDeflatedStream;
+    sal_Int32   m_nRawDeflatedCrc;
+    sal_Int64   m_nRawDeflatedSize;
+    sal_Int64   m_nRawDeflatedCompressedSize;
+
     /// Check that m_xStream implements io::XSeekable and return it
     css::uno::Reference< css::io::XInputStream > const & GetOwnSeekStream();
     /// get raw data using unbuffered stream
     /// @throws css::uno::RuntimeException
     css::uno::Reference< css::io::XInputStream > getRawData();
+    void ClearRawDeflatedData();
+    /// whether m_xRawDeflatedStream still holds all of the deflated data, positioned at its start
+    bool IsRawDeflatedDataUsable();
 
 public:
     bool IsPackageMember () const { return m_nStreamMode == PACKAGE_STREAM_PACKAGEMEMBER;}
@@ -9,12 +9,20 @@
 
 #include <unotest/bootstrapfixturebase.hxx>
 
+#include <comphelper/storagehelper.hxx>
+
 #include <com/sun/star/beans/NamedValue.hpp>
 #include <com/sun/star/beans/XPropertySet.hpp>
 #include <com/sun/star/container/XHierarchicalNameAccess.hpp>
+#include <com/sun/star/embed/ElementModes.hpp>
 #include <com/sun/star/embed/StorageFormats.hpp>
+#include <com/sun/star/embed/XTransactedObject.hpp>
+#include <com/sun/star/io/XStream.hpp>
+#include <com/sun/star/lang/XComponent.hpp>
 #include <com/sun/star/packages/zip/ZipIOException.hpp>
 
+#include <algorithm>
+
 using namespace ::com::sun::star;
 
 class ZipPackageTest : public test::BootstrapFixtureBase
@@ -501,6 +509,104 @@ CPPUNIT_TEST_FIXTURE(ZipPackageTest, testTdf166862)
     CPPUNIT_ASSERT_EQUAL(sal_Int64(43886), aPic->getPropertyValue(u"Size"_ustr).get<sal_Int64>());
 }
 
+CPPUNIT_TEST_FIXTURE(ZipPackageTest, testCopyUnchangedDeflatedStream)
+{
+    // an unchanged deflated stream is copied over without compressing it again,
+    // make sure the data survives that and later changes are not lost
+    uno::Sequence<sal_Int8> aData(300000);
+    auto pData = aData.getArray();
+    for (sal_Int32 i = 0; i < aData.getLength(); ++i)
+        pData[i] = static_cast<sal_Int8>('a' + (i * 7) % 23);
+
+    uno::Reference<embed::XStorage> xSource
+        = comphelper::OStorageHelper::GetTemporaryStorage(m_xContext);
+    {
+        uno::Reference<io::XStream> xStream
+            = xSource->openStreamElement(u"content.xml"_ustr, embed::ElementModes::READWRITE);
+        uno::Reference<beans::XPropertySet> xProps(xStream, uno::UNO_QUERY_THROW);
+        xProps->setPropertyValue(u"MediaType"_ustr, uno::Any(u"text/xml"_ustr));
+        xStream->getOutputStream()->writeBytes(aData);
+        xStream->getOutputStream()->closeOutput();
+    }
+    uno::Reference<embed::XTransactedObject>(xSource, uno::UNO_QUERY_THROW)->commit();
+
+    auto lcl_readStream = [](const uno::Reference<embed::XStorage>& xStorage) {
+        uno::Reference<io::XStream> xStream
+            = xStorage->openStreamElement(u"content.xml"_ustr, embed::ElementModes::READ);
+        uno::Sequence<sal_Int8> aRead;
+        xStream->getInputStream()->readBytes(aRead, 1000000);
+        return aRead;
+    };
+
+    for (bool bModify : { false, true })
+    {
+        uno::Reference<embed::XStorage> xTarget
+            = comphelper::OStorageHelper::GetTemporaryStorage(m_xContext);
+        xSource->copyToStorage(xTarget);
+        if (bModify)
+        {
+            uno::Reference<io::XStream> xStream = xTarget->openStreamElement(
+                u"content.xml"_ustr, embed::ElementModes::READWRITE | embed::ElementModes::TRUNCATE);
+            xStream->getOutputStream()->writeBytes(aData);
+            xStream->getOutputStream()->writeBytes(aData);
+            xStream->getOutputStream()->closeOutput();
+        }
+        uno::Reference<embed::XTransactedObject>(xTarget, uno::UNO_QUERY_THROW)->commit();
+
+        uno::Sequence<sal_Int8> aRead = lcl_readStream(xTarget);
+        CPPUNIT_ASSERT_EQUAL(aData.getLength() * (bModify ? 2 : 1), aRead.getLength());
+        CPPUNIT_ASSERT(std::equal(aData.begin(), aData.end(), aRead.begin()));
+    }
+}
+
+CPPUNIT_TEST_FIXTURE(ZipPackageTest, testCopyDeflatedStreamSourceGone)
+{
+    // the copy has to stay self-contained: the source may be changed or closed before the
+    // target is committed
+    uno::Sequence<sal_Int8> aData(300000);
+    auto pData = aData.getArray();
+    for (sal_Int32 i = 0; i < aData.getLength(); ++i)
+        pData[i] = static_cast<sal_Int8>('a' + (i * 5) % 19);
+
+    auto lcl_writeStream
+        = [](const uno::Reference<embed::XStorage>& xStorage, const uno::Sequence<sal_Int8>& rData) {
+              uno::Reference<io::XStream> xStream = xStorage->openStreamElement(
+                  u"content.xml"_ustr,
+                  embed::ElementModes::READWRITE | embed::ElementModes::TRUNCATE);
+              uno::Reference<beans::XPropertySet> xProps(xStream, uno::UNO_QUERY_THROW);
+              xProps->setPropertyValue(u"MediaType"_ustr, uno::Any(u"text/xml"_ustr));
+              xStream->getOutputStream()->writeBytes(rData);
+              xStream->getOutputStream()->closeOutput();
+              uno::Reference<embed::XTransactedObject>(xStorage, uno::UNO_QUERY_THROW)->commit();
+          };
+
+    for (bool bDispose : { false, true })
+    {
+        uno::Reference<embed::XStorage> xSource
+            = comphelper::OStorageHelper::GetTemporaryStorage(m_xContext);
+        lcl_writeStream(xSource, aData);
+
+        uno::Reference<embed::XStorage> xTarget
+            = comphelper::OStorageHelper::GetTemporaryStorage(m_xContext);
+        xSource->copyToStorage(xTarget);
+
+        if (bDispose)
+            uno::Reference<lang::XComponent>(xSource, uno::UNO_QUERY_THROW)->dispose();
+        else
+            lcl_writeStream(xSource, uno::Sequence<sal_Int8>(100));
+        xSource.clear();
+
+        uno::Reference<embed::XTransactedObject>(xTarget, uno::UNO_QUERY_THROW)->commit();
+
+        uno::Reference<io::XStream> xStream
+            = xTarget->openStreamElement(u"content.xml"_ustr, embed::ElementModes::READ);
+        uno::Sequence<sal_Int8> aRead;
+        xStream->getInputStream()->readBytes(aRead, 1000000);
+        CPPUNIT_ASSERT_EQUAL(aData.getLength(), aRead.getLength());
+        CPPUNIT_ASSERT(std::equal(aData.begin(), aData.end(), aRead.begin()));
+    }
+}
+
 //CPPUNIT_TEST_SUITE_REGISTRATION(...);
 //CPPUNIT_PLUGIN_IMPLEMENT();
 
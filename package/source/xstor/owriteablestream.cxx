@@ -646,10 +646,18 @@ void OWriteStream_Impl::InsertStreamDirectly( const uno::Reference< io::XInputSt
     // Thus if Compressed property is provided it must be set as the latest one
     bool bCompressedIsSet = false;
     bool bCompressed = false;
+    uno::Any aRawDeflatedData;
     OUString aComprPropName( u"Compressed"_ustr );
     OUString aMedTypePropName( u"MediaType"_ustr );
     for ( const auto& rProp : aProps )
     {
+        if ( m_nStorageType == embed::StorageFormats::PACKAGE && rProp.Name == RAW_DEFLATED_DATA_PROPERTY )
+        {
+            // passed on to the package stream only after the Compressed property
+            aRawDeflatedData = rProp.Value;
+            continue;
+        }
+
         if ( rProp.Name == aComprPropName )
         {
             bCompressedIsSet = true;
@@ -680,6 +688,11 @@ void OWriteStream_Impl::InsertStreamDirectly( const uno::Reference< io::XInputSt
         m_bCompressedSetExplicit = true;
     }
 
+    // the package decides on storing whether the deflated data can be used,
+    // e.g. it can not if the stream has to be encrypted with the common key
+    if ( aRawDeflatedData.hasValue() )
+        xPropertySet->setPropertyValue( RAW_DEFLATED_DATA_PROPERTY, aRawDeflatedData );
+
     if ( m_bUseCommonEncryption )
     {
         if ( m_nStorageType != embed::StorageFormats::PACKAGE )
@@ -771,6 +784,20 @@ void OWriteStream_Impl::Commit()
             xPropertySet->setPropertyValue( rProp.Name, rProp.Value );
     }
 
+    if ( m_aRawDeflatedData.hasValue() && xNewPackageStream != m_xPackageStream )
+    {
+        try
+        {
+            xPropertySet->setPropertyValue( RAW_DEFLATED_DATA_PROPERTY, m_aRawDeflatedData );
+        }
+        catch( const uno::Exception& )
+        {
+            // the data will just be compressed again
+            TOOLS_INFO_EXCEPTION("package.xstor", "Raw deflated data rejected");
+        }
+    }
+    m_aRawDeflatedData.clear();
+
     if ( m_bUseCommonEncryption )
     {
         if ( m_nStorageType != embed::StorageFormats::PACKAGE )
@@ -818,6 +845,7 @@ void OWriteStream_Impl::Revert()
     m_oTempFile.reset();
 
     m_aProps.realloc( 0 );
+    m_aRawDeflatedData.clear();
 
     m_bHasDataToFlush = false;
 
@@ -1058,6 +1086,28 @@ void OWriteStream_Impl::CopyInternallyTo_Impl( const uno::Reference< io::XStream
             throw io::IOException(); // TODO
 
         OStorage_Impl::completeStorageStreamCopy_Impl( xOwnStream, xDestStream, m_nStorageType, GetAllRelationshipsIfAny() );
+
+        // the data was not changed since the last commit, so if the destination is one
+        // of our package streams it can reuse the already deflated representation
+        OWriteStream* pDest = dynamic_cast< OWriteStream* >( xDestStream.get() );
+        if ( pDest && pDest->m_pImpl && m_nStorageType == embed::StorageFormats::PACKAGE
+          && pDest->m_nStorageType == embed::StorageFormats::PACKAGE
+          && !m_bHasDataToFlush && m_xPackageStream.is() )
+        {
+            uno::Any aRawData;
+            try
+            {
+                uno::Reference< beans::XPropertySet > xPropertySet( m_xPackageStream, uno::UNO_QUERY_THROW );
+                aRawData = xPropertySet->getPropertyValue( RAW_DEFLATED_DATA_PROPERTY );
+            }
+            catch( const uno::Exception& )
+            {
+                TOOLS_INFO_EXCEPTION("package.xstor", "No raw deflated data");
+            }
+
+            ::osl::MutexGuard aDestGuard( pDest->m_pImpl->m_xMutex->GetMutex() );
+            pDest->m_pImpl->m_aRawDeflatedData = aRawData;
+        }
     }
 }
 
@@ -2033,6 +2083,7 @@ void SAL_CALL OWriteStream::writeBytes( const uno::Sequence< sal_Int8 >& aData )
 
     m_xOutStream->writeBytes( aData );
     m_pImpl->m_bHasDataToFlush = true;
+    m_pImpl->m_aRawDeflatedData.clear();
 
     ModifyParentUnlockMutex_Impl( aGuard );
 }
@@ -2056,6 +2107,7 @@ void OWriteStream::writeBytes( const sal_Int8* pData, sal_Int32 nBytesToWrite )
         m_xOutStream->writeBytes( aData );
     }
     m_pImpl->m_bHasDataToFlush = true;
+    m_pImpl->m_aRawDeflatedData.clear();
 
     ModifyParentUnlockMutex_Impl( aGuard );
 }
@@ -2171,6 +2223,7 @@ void SAL_CALL OWriteStream::truncate()
     xTruncate->truncate();
 
     m_pImpl->m_bHasDataToFlush = true;
+    m_pImpl->m_aRawDeflatedData.clear();
 
     ModifyParentUnlockMutex_Impl( aGuard );
 }
@@ -115,6 +115,11 @@ struct OWriteStream_Impl
     sal_Int16 m_nRelInfoStatus;
     sal_Int32 m_nRelId;
 
+    // deflated data of the unchanged stream this one was copied from, handed to the
+    // package stream on commit so that it does not need to be compressed once more;
+    // dropped as soon as the stream is written to
+    css::uno::Any m_aRawDeflatedData;
+
 private:
     void GetFilledTempFileIfNo( const css::uno::Reference< css::io::XInputStream >& xStream );
     void FillTempGetFileName();
@@ -788,9 +788,33 @@ void OStorage_Impl::CopyStorageElement( SotElement_Impl* pElement,
                 else
                 {
                     // for now get just nonseekable access to the stream
-                    // TODO/LATER: the raw stream can be used
-
                     xInputToInsert = pElement->m_xStream->m_xPackageStream->getDataStream();
+
+                    // an unchanged deflated stream does not need to be compressed again,
+                    // our own destination can take over the already deflated data as is
+                    if ( m_nStorageType == embed::StorageFormats::PACKAGE
+                      && dynamic_cast< OStorage* >( xDest.get() ) )
+                    {
+                        uno::Reference< beans::XPropertySet > xSrcProps( pElement->m_xStream->m_xPackageStream, uno::UNO_QUERY );
+                        uno::Any aRawData;
+                        try
+                        {
+                            if ( xSrcProps.is() )
+                                aRawData = xSrcProps->getPropertyValue( RAW_DEFLATED_DATA_PROPERTY );
+                        }
+                        catch( const uno::Exception& )
+                        {
+                            TOOLS_INFO_EXCEPTION("package.xstor", "No raw deflated data");
+                        }
+
+                        if ( aRawData.hasValue() )
+                        {
+                            aStrProps.realloc( ++nNum );
+                            auto pStrProps = aStrProps.getArray();
+                            pStrProps[nNum-1].Name = RAW_DEFLATED_DATA_PROPERTY;
+                            pStrProps[nNum-1].Value = aRawData;
+                        }
+                    }
                 }
 
                 if ( !xInputToInsert.is() )
@@ -92,6 +92,9 @@ ZipPackageStream::ZipPackageStream ( ZipPackage & rNewPackage,
 , m_bFromManifest( false )
 , m_bUseWinEncoding( false )
 , m_bRawStream( false )
+, m_nRawDeflatedCrc( 0 )
+, m_nRawDeflatedSize( 0 )
+, m_nRawDeflatedCompressedSize( 0 )
 {
     m_xContext = xContext;
     m_nFormat = nFormat;
@@ -663,9 +666,65 @@ bool ZipPackageStream::saveChild(
     }
 
     bool bSuccess = true;
+    if ( m_xRawDeflatedStream.is() && !IsPackageMember() && !m_bRawStream
+      && !bToBeEncrypted && bToBeCompressed && !IsRawDeflatedDataUsable() )
+    {
+        // nothing is written yet, so the plain data can still be deflated the usual way
+        SAL_WARN( "package", "raw deflated data of " << rPath << " is not usable any more" );
+        ClearRawDeflatedData();
+    }
+
+    if ( m_xRawDeflatedStream.is() && !IsPackageMember() && !m_bRawStream
+      && !bToBeEncrypted && bToBeCompressed )
+    {
+        // The data was taken unchanged from another package, its deflated
+        // form can be written as is instead of compressing it once more
+        pTempEntry->nMethod = DEFLATED;
+        pTempEntry->nCrc = m_nRawDeflatedCrc;
+        pTempEntry->nSize = m_nRawDeflatedSize;
+        pTempEntry->nCompressedSize = m_nRawDeflatedCompressedSize;
+
+        try
+        {
+            ZipOutputStream::setEntry(*pTempEntry);
+            rZipOut.writeLOC(std::move(pAutoTempEntry));
+
+            uno::Sequence < sal_Int8 > aSeq ( n_ConstBufferSize );
+            sal_Int32 nLength;
+            sal_Int64 nWritten = 0;
+
+            do
+            {
+                nLength = m_xRawDeflatedStream->readBytes( aSeq, n_ConstBufferSize );
+                if (nLength != n_ConstBufferSize)
+                    aSeq.realloc(nLength);
+
+                rZipOut.rawWrite(aSeq);
+                nWritten += nLength;
+            }
+            while ( nLength == n_ConstBufferSize );
+
+            rZipOut.rawCloseEntry();
+
+            // the LOC header is already out, a short source can not be repaired any more
+            if ( nWritten != m_nRawDeflatedCompressedSize )
+            {
+                SAL_WARN( "package", "raw deflated data of " << rPath << " has unexpected size" );
+                bSuccess = false;
+            }
+        }
+        catch ( ZipException& )
+        {
+            bSuccess = false;
+        }
+        catch ( io::IOException& )
+        {
+            bSuccess = false;
+        }
+    }
     // If the entry is already stored in the zip file in the format we
     // want for this write...copy it raw
-    if ( !bUseNonSeekableAccess
+    else if ( !bUseNonSeekableAccess
       && ( m_bRawStream || bTransportOwnEncrStreamAsRaw
         || ( IsPackageMember() && !bToBeEncrypted
           && ( ( aEntry.nMethod == DEFLATED && bToBeCompressed )
@@ -880,6 +939,7 @@ void ZipPackageStream::successfullyWritten( ZipEntry const *pEntry )
             m_xStream.clear();
             m_bHasSeekable = false;
         }
+        ClearRawDeflatedData();
         SetPackageMember ( true );
     }
 
@@ -913,12 +973,44 @@ void SAL_CALL ZipPackageStream::setInputStream( const uno::Reference< io::XInput
     // if seekable access is required the wrapping will be done on demand
     m_xStream = aStream;
     m_oImportedAlgorithms.reset();
+    ClearRawDeflatedData();
     m_bHasSeekable = false;
     SetPackageMember ( false );
     aEntry.nTime = -1;
     m_nStreamMode = PACKAGE_STREAM_DETECT;
 }
 
+void ZipPackageStream::ClearRawDeflatedData()
+{
+    if ( m_xRawDeflatedStream.is() )
+    {
+        try
+        {
+            m_xRawDeflatedStream->closeInput();
+        }
+        catch ( const uno::Exception& )
+        {
+        }
+        m_xRawDeflatedStream.clear();
+    }
+}
+
+bool ZipPackageStream::IsRawDeflatedDataUsable()
+{
+    try
+    {
+        uno::Reference< io::XSeekable > xSeek( m_xRawDeflatedStream, UNO_QUERY );
+        if ( !xSeek.is() || xSeek->getLength() != m_nRawDeflatedCompressedSize )
+            return false;
+        xSeek->seek( 0 );
+        return true;
+    }
+    catch ( const uno::Exception& )
+    {
+        return false;
+    }
+}
+
 uno::Reference< io::XInputStream > ZipPackageStream::getRawData()
 {
     try
@@ -1131,6 +1223,7 @@ void SAL_CALL ZipPackageStream::setRawStream( const uno::Reference< io::XInputSt
 
     // the raw stream MUST have seekable access
     m_bHasSeekable = true;
+    ClearRawDeflatedData();
 
     SetPackageMember ( false );
     aEntry.nTime = -1;
@@ -1316,6 +1409,44 @@ void SAL_CALL ZipPackageStream::setPropertyValue( const OUString& aPropertyName,
         m_bToBeCompressed = bCompr;
         m_bCompressedIsSetFromOutside = true;
     }
+    else if ( aPropertyName == RAW_DEFLATED_DATA_PROPERTY )
+    {
+        // must follow setDataStream(), whose plain stream stays the fallback
+        // in case the entry has to be encrypted or stored after all
+        uno::Sequence< beans::NamedValue > aRawData;
+        if ( !( aValue >>= aRawData ) )
+            throw IllegalArgumentException(THROW_WHERE "Wrong type for RawDeflatedData property!",
+                                            uno::Reference< XInterface >(),
+                                            2 );
+
+        if ( m_nStreamMode != PACKAGE_STREAM_DATA )
+            throw beans::PropertyVetoException(THROW_WHERE );
+
+        uno::Reference< io::XInputStream > xRaw;
+        sal_Int32 nCrc = 0;
+        bool bHasCrc = false;
+        sal_Int64 nSize = -1, nCompressedSize = -1;
+        for ( const auto& rValue : aRawData )
+        {
+            if ( rValue.Name == "RawStream" )
+                rValue.Value >>= xRaw;
+            else if ( rValue.Name == "Crc" )
+                bHasCrc = ( rValue.Value >>= nCrc );
+            else if ( rValue.Name == "Size" )
+                rValue.Value >>= nSize;
+            else if ( rValue.Name == "CompressedSize" )
+                rValue.Value >>= nCompressedSize;
+        }
+
+        ClearRawDeflatedData();
+        if ( xRaw.is() && bHasCrc && nSize >= 0 && nCompressedSize >= 0 )
+        {
+            m_xRawDeflatedStream = std::move(xRaw);
+            m_nRawDeflatedCrc = nCrc;
+            m_nRawDeflatedSize = nSize;
+            m_nRawDeflatedCompressedSize = nCompressedSize;
+        }
+    }
     else
         throw beans::UnknownPropertyException(aPropertyName);
 }
@@ -1350,6 +1481,46 @@ Any SAL_CALL ZipPackageStream::getPropertyValue( const OUString& PropertyName )
     {
         return Any(m_aStorageEncryptionKeys);
     }
+    else if ( PropertyName == RAW_DEFLATED_DATA_PROPERTY )
+    {
+        // Only an unchanged, unencrypted and deflated member of the package can
+        // provide its data as is, everything else has to go through getDataStream()
+        if ( !IsPackageMember() || m_bIsEncrypted || m_bToBeEncrypted || aEntry.nMethod != DEFLATED
+          || aEntry.nSize < 0 || aEntry.nCompressedSize < 0 )
+            return Any();
+
+        // Take a copy of the deflated bytes now: the receiver writes them only when
+        // its own package is committed, and by then this package may have been
+        // closed or overwritten. Copying is still much cheaper than deflating again.
+        rtl::Reference< utl::TempFileFastService > xTempFile;
+        try
+        {
+            uno::Reference< io::XInputStream > xRaw = getRawData();
+            if ( !xRaw.is() )
+                return Any();
+
+            xTempFile = new utl::TempFileFastService;
+            ::comphelper::OStorageHelper::CopyInputToOutput( xRaw, xTempFile );
+            xTempFile->closeOutput();
+            if ( xTempFile->getLength() != aEntry.nCompressedSize )
+            {
+                SAL_WARN( "package", "unexpected size of deflated data" );
+                return Any();
+            }
+            xTempFile->seek( 0 );
+        }
+        catch ( const uno::Exception& )
+        {
+            TOOLS_INFO_EXCEPTION( "package", "cannot copy deflated data" );
+            return Any();
+        }
+
+        return Any(uno::Sequence< beans::NamedValue >{
+            { u"RawStream"_ustr, Any(uno::Reference< io::XInputStream >(xTempFile->getInputStream())) },
+            { u"Crc"_ustr, Any(aEntry.nCrc) },
+            { u"Size"_ustr, Any(aEntry.nSize) },
+            { u"CompressedSize"_ustr, Any(aEntry.nCompressedSize) } });
+    }
     else
         throw beans::UnknownPropertyException(PropertyName);
 }
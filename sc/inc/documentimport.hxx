@@ -29,6 +29,7 @@ struct ScSetStringParam;
 struct ScTabOpParam;
 struct ScDocumentImportImpl;
 enum class SvtScriptType : sal_uInt8;
+namespace svl { class SharedString; }
 
 /**
  * Accessor class to ScDocument.  Its purpose is to allow import filter to
@@ -99,6 +100,8 @@ public:
             const ScSetStringParam* pStringParam = nullptr);
     void setNumericCell(const ScAddress& rPos, double fVal);
     void setStringCell(const ScAddress& rPos, const OUString& rStr);
+    /** Insert a string that has already been interned in the document's string pool. */
+    void setStringCell(const ScAddress& rPos, const svl::SharedString& rStr);
     void setEditCell(const ScAddress& rPos, std::unique_ptr<EditTextObject> pEditText);
 
     void setFormulaCell(
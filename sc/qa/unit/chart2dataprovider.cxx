@@ -10,11 +10,14 @@
 #include <sal/config.h>
 
 #include <comphelper/propertyvalue.hxx>
+#include <cppuhelper/implbase.hxx>
 
 #include <chart2uno.hxx>
+#include <docfunc.hxx>
 
 #include <com/sun/star/chart/ChartDataRowSource.hpp>
 #include <com/sun/star/chart2/data/XDataSource.hpp>
+#include <com/sun/star/util/XModifyBroadcaster.hpp>
 
 #include "helper/qahelper.hxx"
 
@@ -27,9 +30,11 @@ public:
     ScChart2DataProviderTest();
 
     void testHeaderExpansion();
+    void testUnchangedDataNotBroadcast();
 
     CPPUNIT_TEST_SUITE(ScChart2DataProviderTest);
     CPPUNIT_TEST(testHeaderExpansion);
+    CPPUNIT_TEST(testUnchangedDataNotBroadcast);
     CPPUNIT_TEST_SUITE_END();
 };
 
@@ -81,6 +86,51 @@ void ScChart2DataProviderTest::testHeaderExpansion()
     lcl_createAndCheckDataProvider(*pDoc, u"$Sheet1.$A$25:$D$28"_ustr, true, true, 4, 2);
 }
 
+namespace
+{
+class ModifyCounter : public cppu::WeakImplHelper<util::XModifyListener>
+{
+public:
+    int mnCount = 0;
+
+    virtual void SAL_CALL modified(const lang::EventObject&) override { ++mnCount; }
+    virtual void SAL_CALL disposing(const lang::EventObject&) override {}
+};
+}
+
+void ScChart2DataProviderTest::testUnchangedDataNotBroadcast()
+{
+    createScDoc();
+
+    ScDocument* pDoc = getScDoc();
+    pDoc->SetValue(ScAddress(0, 0, 0), 1.0);
+    pDoc->SetString(ScAddress(1, 0, 0), u"=A1*0"_ustr);
+    pDoc->SetString(ScAddress(2, 0, 0), u"=A1*2"_ustr);
+
+    rtl::Reference<ScChart2DataProvider> xDataProvider = new ScChart2DataProvider(pDoc);
+    Reference<chart2::data::XDataSequence> xConstValues
+        = xDataProvider->createDataSequenceByRangeRepresentation(u"$Sheet1.$B$1"_ustr);
+    Reference<chart2::data::XDataSequence> xChangingValues
+        = xDataProvider->createDataSequenceByRangeRepresentation(u"$Sheet1.$C$1"_ustr);
+
+    rtl::Reference<ModifyCounter> xConstCounter(new ModifyCounter);
+    rtl::Reference<ModifyCounter> xChangingCounter(new ModifyCounter);
+    Reference<util::XModifyBroadcaster>(xConstValues, UNO_QUERY_THROW)
+        ->addModifyListener(xConstCounter);
+    Reference<util::XModifyBroadcaster>(xChangingValues, UNO_QUERY_THROW)
+        ->addModifyListener(xChangingCounter);
+
+    // fill the data caches, like a chart does
+    xConstValues->getData();
+    xChangingValues->getData();
+
+    getScDocShell()->GetDocFunc().SetValueCell(ScAddress(0, 0, 0), 2.0, false);
+
+    // B1 was recalculated, but its result did not change
+    CPPUNIT_ASSERT_EQUAL(0, xConstCounter->mnCount);
+    CPPUNIT_ASSERT_EQUAL(1, xChangingCounter->mnCount);
+}
+
 ScChart2DataProviderTest::ScChart2DataProviderTest()
     : ScModelTestBase(u"sc/qa/unit/data"_ustr)
 {
@@ -248,8 +248,9 @@ void ImportExcel8::Labelsst()
     if( GetAddressConverter().ConvertAddress( aScPos, aXclPos, GetCurrScTab(), true ) )
     {
         GetXFRangeBuffer().SetXF( aScPos, nXF );
-        const XclImpString* pXclStr = GetSst().GetString(nSst);
-        if (pXclStr)
+        if (const svl::SharedString* pSharedStr = GetSst().GetPlainSharedString(nSst, nXF))
+            GetDocImport().setStringCell(aScPos, *pSharedStr);
+        else if (const XclImpString* pXclStr = GetSst().GetString(nSst))
             XclImpStringHelper::SetToDocument(GetDocImport(), aScPos, *this, *pXclStr, nXF);
     }
 }
@@ -29,6 +29,7 @@
 #include <editeng/eeitem.hxx>
 #include <svl/intitem.hxx>
 #include <svl/stritem.hxx>
+#include <svl/sharedstringpool.hxx>
 #include <editeng/flditem.hxx>
 #include <editeng/editobj.hxx>
 #include <unotools/charclass.hxx>
@@ -82,6 +83,7 @@ void XclImpSst::ReadSst( XclImpStream& rStrm )
         nStrCount = nBytesAvailable;
     }
     maStrings.clear();
+    maSharedStrings.clear();
     maStrings.reserve(nStrCount);
     while( (nStrCount > 0) && rStrm.IsValid() )
     {
@@ -97,6 +99,27 @@ const XclImpString* XclImpSst::GetString( sal_uInt32 nSstIndex ) const
     return (nSstIndex < maStrings.size()) ? &maStrings[ nSstIndex ] : nullptr;
 }
 
+const svl::SharedString* XclImpSst::GetPlainSharedString( sal_uInt32 nSstIndex, sal_uInt16 nXFIndex ) const
+{
+    // see XclImpStringHelper::SetToDocument() for what needs an edit cell
+    const XclImpString* pString = GetString( nSstIndex );
+    if( !pString || pString->IsRich() )
+        return nullptr;
+    const XclImpFont* pFont = GetXFBuffer().GetFont( nXFIndex );
+    if( pFont && pFont->HasEscapement() )
+        return nullptr;
+    const OUString& rText = pString->GetText();
+    if( rText.isEmpty() || rText.indexOf( '\n' ) != -1 || rText.indexOf( '\r' ) != -1 )
+        return nullptr;
+
+    if( maSharedStrings.size() != maStrings.size() )
+        maSharedStrings.resize( maStrings.size() );
+    svl::SharedString& rShared = maSharedStrings[ nSstIndex ];
+    if( !rShared.getData() )
+        rShared = GetDoc().GetSharedStringPool().intern( rText );
+    return &rShared;
+}
+
 // Hyperlinks =================================================================
 
 namespace {
@@ -24,6 +24,7 @@
 #include "xiroot.hxx"
 #include <validat.hxx>
 #include <tabprotection.hxx>
+#include <svl/sharedstring.hxx>
 
 #include <map>
 #include <vector>
@@ -64,9 +65,15 @@ public:
     /** Returns a pointer to the string with the passed index. */
     const XclImpString* GetString( sal_uInt32 nSstIndex ) const;
 
+    /** Returns the interned string with the passed index, if it can be inserted as a plain
+        string cell with the passed XF, otherwise nullptr.
+        @descr  Each entry is interned only once, however many cells refer to it. */
+    const svl::SharedString* GetPlainSharedString( sal_uInt32 nSstIndex, sal_uInt16 nXFIndex ) const;
+
 private:
     typedef ::std::vector< XclImpString > XclImpStringVec;
     XclImpStringVec     maStrings;          /// List with all strings in the SST.
+    mutable std::vector< svl::SharedString > maSharedStrings; /// Interned plain strings, filled on demand.
 };
 
 // Hyperlinks =================================================================
@@ -2886,12 +2886,34 @@ void ScChart2DataSequence::Notify( SfxBroadcaster& /*rBC*/, const SfxHint& rHint
 
             if ( m_bGotDataChangedHint && m_pDocument )
             {
+                std::shared_ptr<std::vector<Item>> xOldDataArray = std::move(m_xDataArray);
+                const uno::Sequence<sal_Int32> aOldHiddenValues = m_aHiddenValues;
                 m_xDataArray.reset(new std::vector<Item>);
-                lang::EventObject aEvent;
-                aEvent.Source = getXWeak();
 
-                if( m_pDocument )
+                // Formula cells in the range broadcast their change even if the result
+                // stays the same, e.g. on recalculation. Listeners, usually a chart that
+                // rebuilds its whole view, are only bothered if the data really differs.
+                bool bChanged = true;
+                if (xOldDataArray && !xOldDataArray->empty() && !m_bExtDataRebuildQueued)
                 {
+                    BuildDataCache();
+                    auto lcl_isSameItem = [](const Item& rA, const Item& rB)
+                    {
+                        return rA.mbIsValue == rB.mbIsValue
+                               && (!rA.mbIsValue || rA.mfValue == rB.mfValue)
+                               && rA.maString == rB.maString && rA.mAddress == rB.mAddress;
+                    };
+                    bChanged = !std::equal(xOldDataArray->begin(), xOldDataArray->end(),
+                                           m_xDataArray->begin(), m_xDataArray->end(),
+                                           lcl_isSameItem)
+                               || aOldHiddenValues != m_aHiddenValues;
+                }
+
+                if (bChanged)
+                {
+                    lang::EventObject aEvent;
+                    aEvent.Source = getXWeak();
+
                     for (const uno::Reference<util::XModifyListener> & xListener: m_aValueListeners)
                         m_pDocument->AddUnoListenerCall( xListener, aEvent );
                 }
@@ -358,6 +358,40 @@ bool StgCache::Read( sal_Int32 nPage, void* pBuf )
     return true;
 }
 
+// Read nPages pages which follow each other in the file with one read,
+// bypassing the cache. Returns the number of pages read, i.e. either
+// all or none of them.
+sal_Int32 StgCache::ReadPages( sal_Int32 nPage, sal_Int32 nPages, void* pBuf )
+{
+    // the header and the one-behind-the-last page are special, see Read()
+    if( nPages <= 1 || nPage < 0 || nPage + nPages > m_nPages )
+    {
+        if( nPages <= 0 )
+            return 0;
+        sal_Int32 nRead = 0;
+        while( nRead < nPages && Read( nPage + nRead, static_cast<sal_uInt8*>(pBuf) + nRead * m_nPageSize ) )
+            ++nRead;
+        return nRead == nPages ? nPages : 0;
+    }
+
+    if( !Good() )
+        return 0;
+
+    const sal_uInt32 nPos = Page2Pos( nPage );
+    const sal_uInt32 nBytes = nPages * m_nPageSize;
+    if( m_pStrm->Tell() != nPos )
+        m_pStrm->Seek( nPos );
+    const sal_uInt32 nRead = m_pStrm->ReadBytes( pBuf, nBytes );
+    SetError( m_pStrm->GetError() );
+    if( !Good() )
+        return 0;
+
+    // real life: the last page may be incomplete
+    if( nRead != nBytes )
+        memset( static_cast<sal_uInt8*>(pBuf) + nRead, 0, nBytes - nRead );
+    return nPages;
+}
+
 bool StgCache::Write( sal_Int32 nPage, void const * pBuf )
 {
     if( Good() )
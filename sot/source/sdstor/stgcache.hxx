@@ -78,6 +78,7 @@ public:
     bool  Open( const OUString& rName, StreamMode );
     void  Close();
     bool  Read( sal_Int32 nPage, void* pBuf );
+    sal_Int32 ReadPages( sal_Int32 nPage, sal_Int32 nPages, void* pBuf ); // consecutive pages
     bool  Write( sal_Int32 nPage, void const * pBuf );
 
     // two routines for accessing FAT pages
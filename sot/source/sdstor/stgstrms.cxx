@@ -391,6 +391,49 @@ sal_Int32 StgStrm::scanBuildPageChainCache()
     return nOptSize;
 }
 
+// Make sure the page chain is known up to the given index, if the FAT allows.
+// Please Note: we build the pagescache incrementally as we go if necessary,
+// so that a corrupted FAT doesn't poison the stream state for earlier reads
+void StgStrm::ExtendPagesCache( size_t nIdx )
+{
+    if( nIdx < m_aPagesCache.size() )
+        return;
+
+    // Extend the FAT cache ! ...
+    size_t nToAdd = nIdx + 1;
+
+    if (m_aPagesCache.empty())
+    {
+        m_aPagesCache.push_back( m_nStart );
+        assert(m_aUsedPageNumbers.empty());
+        m_aUsedPageNumbers.insert(m_nStart);
+    }
+
+    nToAdd -= m_aPagesCache.size();
+
+    sal_Int32 nBgn = m_aPagesCache.back();
+
+    // Start adding pages while we can
+    while (nToAdd > 0 && nBgn >= 0)
+    {
+        sal_Int32 nOldBgn = nBgn;
+        nBgn = m_pFat->GetNextPage(nOldBgn);
+        if( nBgn >= 0 )
+        {
+            //returned second is false if it already exists
+            if (!m_aUsedPageNumbers.insert(nBgn).second)
+            {
+                SAL_WARN ("sot", "Error: page number " << nBgn << " already in chain for stream");
+                break;
+            }
+
+            //very much the normal case
+            m_aPagesCache.push_back(nBgn);
+            --nToAdd;
+        }
+    }
+}
+
 // Compute page number and offset for the given byte position.
 // If the position is behind the size, set the stream right
 // behind the EOF.
@@ -414,46 +457,8 @@ bool StgStrm::Pos2Page( sal_Int32 nBytePos )
 
     // See fdo#47644 for a .doc with a vast amount of pages where seeking around the
     // document takes a colossal amount of time
-
-    // Please Note: we build the pagescache incrementally as we go if necessary,
-    // so that a corrupted FAT doesn't poison the stream state for earlier reads
     size_t nIdx = nNew / m_nPageSize;
-    if( nIdx >= m_aPagesCache.size() )
-    {
-        // Extend the FAT cache ! ...
-        size_t nToAdd = nIdx + 1;
-
-        if (m_aPagesCache.empty())
-        {
-            m_aPagesCache.push_back( m_nStart );
-            assert(m_aUsedPageNumbers.empty());
-            m_aUsedPageNumbers.insert(m_nStart);
-        }
-
-        nToAdd -= m_aPagesCache.size();
-
-        sal_Int32 nBgn = m_aPagesCache.back();
-
-        // Start adding pages while we can
-        while (nToAdd > 0 && nBgn >= 0)
-        {
-            sal_Int32 nOldBgn = nBgn;
-            nBgn = m_pFat->GetNextPage(nOldBgn);
-            if( nBgn >= 0 )
-            {
-                //returned second is false if it already exists
-                if (!m_aUsedPageNumbers.insert(nBgn).second)
-                {
-                    SAL_WARN ("sot", "Error: page number " << nBgn << " already in chain for stream");
-                    break;
-                }
-
-                //very much the normal case
-                m_aPagesCache.push_back(nBgn);
-                --nToAdd;
-            }
-        }
-    }
+    ExtendPagesCache( nIdx );
 
     if ( nIdx > m_aPagesCache.size() )
     {
@@ -911,9 +916,25 @@ void* StgDataStrm::GetPtr( sal_Int32 Pos, bool bDirty )
     return nullptr;
 }
 
-// This could easily be adapted to a better algorithm by determining
-// the amount of consecutable blocks before doing a read. The result
-// is the number of bytes read. No error is generated on EOF.
+// Count the pages starting with the current one which follow each other
+// in the file and are not in the cache, so they can be read in one go.
+sal_Int32 StgDataStrm::GetUncachedRun( sal_Int32 nMaxPages )
+{
+    const size_t nIdx = GetPos() / m_nPageSize;
+    ExtendPagesCache( nIdx + nMaxPages - 1 );
+    if( nIdx >= m_aPagesCache.size() || m_aPagesCache[ nIdx ] != m_nPage )
+        return 1;
+
+    sal_Int32 nRun = 1;
+    while( nRun < nMaxPages && nIdx + nRun < m_aPagesCache.size()
+        && m_aPagesCache[ nIdx + nRun ] == m_nPage + nRun
+        && !m_rIo.Find( m_nPage + nRun ).is() )
+        ++nRun;
+    return nRun;
+}
+
+// Pages which follow each other in the file are read with a single
+// read. The result is the number of bytes read. No error is generated on EOF.
 
 sal_Int32 StgDataStrm::Read( void* pBuf, sal_Int32 n )
 {
@@ -944,8 +965,25 @@ sal_Int32 StgDataStrm::Read( void* pBuf, sal_Int32 n )
                     nRes = nBytes;
                 }
                 else
-                    // do a direct (unbuffered) read
+                {
+                    // do a direct (unbuffered) read of all the consecutive pages
+                    const sal_Int32 nRun = GetUncachedRun( n / m_nPageSize );
+                    if( nRun > 1 )
+                    {
+                        const sal_Int32 nRunBytes = m_rIo.ReadPages( m_nPage, nRun, p ) * m_nPageSize;
+                        nDone += nRunBytes;
+                        SetPos(GetPos() + nRunBytes, true);
+                        n -= nRunBytes;
+                        if( nRunBytes != nRun * m_nPageSize )
+                            break;  // read error or EOF
+                        // behind the last page of the run, see below
+                        m_nOffset = m_nPageSize;
+                        if (!Pos2Page(GetPos()))
+                            break;
+                        continue;
+                    }
                     nRes = static_cast<short>(m_rIo.Read( m_nPage, p )) * m_nPageSize;
+                }
             }
             else
             {
@@ -77,6 +77,7 @@ protected:
     std::vector<sal_Int32> m_aPagesCache;
     o3tl::sorted_vector<sal_Int32> m_aUsedPageNumbers;
     sal_Int32 scanBuildPageChainCache();
+    void ExtendPagesCache( size_t nIdx );
     bool  Copy( sal_Int32 nFrom, sal_Int32 nBytes );
     void SetPos(sal_Int32 nPos, bool bValid) { m_nPos = nPos; m_bBytePosValid = bValid; }
     explicit StgStrm( StgIo& );
@@ -118,6 +119,7 @@ class StgDataStrm : public StgStrm      // a physical data stream
 {
     short m_nIncr;                        // size adjust increment
     void Init( sal_Int32 nBgn, sal_Int32 nLen );
+    sal_Int32 GetUncachedRun( sal_Int32 nMaxPages );
 public:
     StgDataStrm( StgIo&, sal_Int32 nBgn, sal_Int32 nLen=-1 );
     StgDataStrm( StgIo&, StgDirEntry& );
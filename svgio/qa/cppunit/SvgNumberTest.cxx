@@ -15,6 +15,7 @@
 #include <cppunit/plugin/TestPlugIn.h>
 
 #include <SvgNumber.hxx>
+#include <svgtools.hxx>
 
 namespace
 {
@@ -22,11 +23,13 @@ class TestNumber : public CppUnit::TestFixture
 {
     void testSetting();
     void testSolve();
+    void testReadNumber();
 
 public:
     CPPUNIT_TEST_SUITE(TestNumber);
     CPPUNIT_TEST(testSetting);
     CPPUNIT_TEST(testSolve);
+    CPPUNIT_TEST(testReadNumber);
     CPPUNIT_TEST_SUITE_END();
 };
 
@@ -87,6 +90,34 @@ void TestNumber::testSolve()
     }
 }
 
+void TestNumber::testReadNumber()
+{
+    {
+        std::u16string_view aText(u"-1.5e2,+.25 7");
+        sal_Int32 nPos(0);
+        double fNum(0.0);
+        CPPUNIT_ASSERT(svgio::svgreader::readNumber(aText, nPos, fNum, aText.size()));
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(-150.0, fNum, 1e-8);
+        CPPUNIT_ASSERT_EQUAL(sal_Int32(6), nPos);
+        svgio::svgreader::skip_char(aText, ',', nPos, aText.size());
+        CPPUNIT_ASSERT(svgio::svgreader::readNumber(aText, nPos, fNum, aText.size()));
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(0.25, fNum, 1e-8);
+        svgio::svgreader::skip_char(aText, ' ', nPos, aText.size());
+        CPPUNIT_ASSERT(svgio::svgreader::readNumber(aText, nPos, fNum, aText.size()));
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(7.0, fNum, 1e-8);
+        CPPUNIT_ASSERT(!svgio::svgreader::readNumber(aText, nPos, fNum, aText.size()));
+    }
+    {
+        // the 'e' of a unit is not taken for an exponent
+        std::u16string_view aText(u"2em");
+        sal_Int32 nPos(0);
+        double fNum(0.0);
+        CPPUNIT_ASSERT(svgio::svgreader::readNumber(aText, nPos, fNum, aText.size()));
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(2.0, fNum, 1e-8);
+        CPPUNIT_ASSERT_EQUAL(sal_Int32(1), nPos);
+    }
+}
+
 CPPUNIT_TEST_SUITE_REGISTRATION(TestNumber);
 }
 
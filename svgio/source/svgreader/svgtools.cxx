@@ -306,38 +306,6 @@ namespace svgio::svgreader
             }
         }
 
-        void copySign(std::u16string_view rCandidate, sal_Int32& nPos, OUStringBuffer& rTarget, const sal_Int32 nLen)
-        {
-            if(nPos < nLen)
-            {
-                const sal_Unicode aChar(rCandidate[nPos]);
-
-                if('+' == aChar || '-' == aChar)
-                {
-                    rTarget.append(aChar);
-                    nPos++;
-                }
-            }
-        }
-
-        void copyNumber(std::u16string_view rCandidate, sal_Int32& nPos, OUStringBuffer& rTarget, const sal_Int32 nLen)
-        {
-            bool bOnNumber(true);
-
-            while(bOnNumber && nPos < nLen)
-            {
-                const sal_Unicode aChar(rCandidate[nPos]);
-
-                bOnNumber = ('0' <= aChar && '9' >= aChar) || '.' == aChar;
-
-                if(bOnNumber)
-                {
-                    rTarget.append(aChar);
-                    nPos++;
-                }
-            }
-        }
-
         void copyHex(std::u16string_view rCandidate, sal_Int32& nPos, OUStringBuffer& rTarget, const sal_Int32 nLen)
         {
             bool bOnHex(true);
@@ -391,10 +359,23 @@ namespace svgio::svgreader
         {
             if(nPos < nLen)
             {
-                OUStringBuffer aNum;
+                // this is called for every single number of a document, so only find
+                // the extent of the number and convert it in place, without copying
+                auto skipSign = [&]()
+                {
+                    if(nPos < nLen && ('+' == rCandidate[nPos] || '-' == rCandidate[nPos]))
+                        nPos++;
+                };
+                auto skipNumber = [&]()
+                {
+                    while(nPos < nLen
+                          && (('0' <= rCandidate[nPos] && '9' >= rCandidate[nPos]) || '.' == rCandidate[nPos]))
+                        nPos++;
+                };
+                const sal_Int32 nStart(nPos);
 
-                copySign(rCandidate, nPos, aNum, nLen);
-                copyNumber(rCandidate, nPos, aNum, nLen);
+                skipSign();
+                skipNumber();
 
                 if(nPos < nLen)
                 {
@@ -404,32 +385,28 @@ namespace svgio::svgreader
                     {
                         // try to read exponential number, but be careful. I had
                         // a case where dx="2em" was used, thus the 'e' was consumed
-                        // by error. First try if there are numbers after the 'e',
-                        // safe current state
+                        // by error. First try if there are numbers after the 'e'
                         nPos++;
-                        const OUString aNum2(aNum);
                         const sal_Int32 nPosAfterE(nPos);
 
-                        aNum.append(aChar);
-                        copySign(rCandidate, nPos, aNum, nLen);
-                        copyNumber(rCandidate, nPos, aNum, nLen);
+                        skipSign();
+                        skipNumber();
 
                         if(nPosAfterE == nPos)
                         {
                             // no number after 'e', go back. Do not
                             // return false, it's still a valid integer number
-                            aNum = aNum2;
                             nPos--;
                         }
                     }
                 }
 
-                if(!aNum.isEmpty())
+                if(nPos > nStart)
                 {
                     rtl_math_ConversionStatus eStatus;
 
                     fNum = rtl::math::stringToDouble(
-                        aNum, '.', ',',
+                        rCandidate.substr(nStart, nPos - nStart), '.', ',',
                         &eStatus);
 
                     return eStatus == rtl_math_ConversionStatus_Ok;
@@ -0,0 +1,175 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4; fill-column: 100 -*- */
+/*
+ * This file is part of the LibreOffice project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <svl/eitem.hxx>
+#include <svl/intitem.hxx>
+#include <svl/itempool.hxx>
+#include <svl/itemset.hxx>
+
+#include <cppunit/TestAssert.h>
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/plugin/TestPlugIn.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace
+{
+constexpr sal_uInt16 ITEM_FIRST = 1;
+constexpr sal_uInt16 ITEM_SECOND = 2;
+constexpr sal_uInt16 ITEM_THIRD = 3;
+constexpr sal_uInt16 SECONDARY_ITEM = 4;
+
+ItemInfoPackage& getItemInfoPackageTest()
+{
+    class ItemInfoPackageTest : public ItemInfoPackage
+    {
+        typedef std::array<ItemInfoStatic, 3> ItemInfoArrayTest;
+        ItemInfoArrayTest maItemInfos{ {
+            // m_nWhich, m_pItem, m_nSlotID, m_nItemInfoFlags
+            { ITEM_FIRST, new SfxUInt16Item(ITEM_FIRST, 1), 10001, SFX_ITEMINFOFLAG_NONE },
+            { ITEM_SECOND, new SfxUInt16Item(ITEM_SECOND, 2), 10002, SFX_ITEMINFOFLAG_NONE },
+            { ITEM_THIRD, new SfxBoolItem(ITEM_THIRD, false), 10003, SFX_ITEMINFOFLAG_NONE },
+        } };
+
+        virtual const ItemInfoStatic& getItemInfoStatic(size_t nIndex) const override
+        {
+            return maItemInfos[nIndex];
+        }
+
+    public:
+        virtual size_t size() const override { return maItemInfos.size(); }
+        virtual const ItemInfo& getItemInfo(size_t nIndex, SfxItemPool& /*rPool*/) override
+        {
+            return maItemInfos[nIndex];
+        }
+    };
+
+    static ItemInfoPackageTest aItemInfoPackageTest;
+    return aItemInfoPackageTest;
+}
+
+ItemInfoPackage& getItemInfoPackageSecondary()
+{
+    class ItemInfoPackageSecondary : public ItemInfoPackage
+    {
+        typedef std::array<ItemInfoStatic, 1> ItemInfoArraySecondary;
+        ItemInfoArraySecondary maItemInfos{ {
+            // m_nWhich, m_pItem, m_nSlotID, m_nItemInfoFlags
+            { SECONDARY_ITEM, new SfxUInt16Item(SECONDARY_ITEM, 4), 10004, SFX_ITEMINFOFLAG_NONE },
+        } };
+
+        virtual const ItemInfoStatic& getItemInfoStatic(size_t nIndex) const override
+        {
+            return maItemInfos[nIndex];
+        }
+
+    public:
+        virtual size_t size() const override { return maItemInfos.size(); }
+        virtual const ItemInfo& getItemInfo(size_t nIndex, SfxItemPool& /*rPool*/) override
+        {
+            return maItemInfos[nIndex];
+        }
+    };
+
+    static ItemInfoPackageSecondary aItemInfoPackageSecondary;
+    return aItemInfoPackageSecondary;
+}
+
+class ItemPoolTest : public CppUnit::TestFixture
+{
+    void testMergedIdRanges();
+    void testConcurrentReaders();
+
+    CPPUNIT_TEST_SUITE(ItemPoolTest);
+    CPPUNIT_TEST(testMergedIdRanges);
+    CPPUNIT_TEST(testConcurrentReaders);
+    CPPUNIT_TEST_SUITE_END();
+};
+
+void ItemPoolTest::testMergedIdRanges()
+{
+    rtl::Reference<SfxItemPool> pPool(new SfxItemPool(u"TestPool"_ustr));
+    pPool->registerItemInfoPackage(getItemInfoPackageTest());
+    CPPUNIT_ASSERT_EQUAL(sal_Int32(1), pPool->GetMergedIdRanges().size());
+    CPPUNIT_ASSERT_EQUAL(sal_uInt16(3), pPool->GetMergedIdRanges().TotalCount());
+
+    // attaching a secondary has to update the ranges eagerly, there is no
+    // lazy computation on access anymore
+    rtl::Reference<SfxItemPool> pSecondary(new SfxItemPool(u"TestSecondary"_ustr));
+    pSecondary->registerItemInfoPackage(getItemInfoPackageSecondary());
+    pPool->SetSecondaryPool(pSecondary.get());
+    CPPUNIT_ASSERT_EQUAL(sal_uInt16(4), pPool->GetMergedIdRanges().TotalCount());
+    CPPUNIT_ASSERT_EQUAL(sal_uInt16(1), pSecondary->GetMergedIdRanges().TotalCount());
+    CPPUNIT_ASSERT(pPool->GetMergedIdRanges().doesContainWhich(SECONDARY_ITEM));
+
+    pPool->SetSecondaryPool(nullptr);
+    CPPUNIT_ASSERT_EQUAL(sal_uInt16(3), pPool->GetMergedIdRanges().TotalCount());
+    CPPUNIT_ASSERT(!pPool->GetMergedIdRanges().doesContainWhich(SECONDARY_ITEM));
+}
+
+void ItemPoolTest::testConcurrentReaders()
+{
+    // Readers on worker threads share a pool and a set that nobody modifies
+    // meanwhile. Meant to be run under ThreadSanitizer, too
+    rtl::Reference<SfxItemPool> pPool(new SfxItemPool(u"TestPool"_ustr));
+    pPool->registerItemInfoPackage(getItemInfoPackageTest());
+
+    SfxItemSet aSource(*pPool);
+    aSource.Put(SfxUInt16Item(ITEM_FIRST, 42));
+    aSource.Put(SfxBoolItem(ITEM_THIRD, true));
+
+    std::atomic<int> nFailures(0);
+    const unsigned nThreads(std::max(2u, std::min(8u, std::thread::hardware_concurrency())));
+    std::vector<std::thread> aThreads;
+
+    for (unsigned a(0); a < nThreads; a++)
+    {
+        aThreads.emplace_back([&]() {
+            for (int b(0); b < 20000; b++)
+            {
+                if (static_cast<const SfxUInt16Item&>(aSource.Get(ITEM_FIRST)).GetValue() != 42)
+                    nFailures++;
+                if (aSource.GetItemState(ITEM_SECOND) != SfxItemState::DEFAULT)
+                    nFailures++;
+                if (static_cast<const SfxUInt16Item&>(aSource.Get(ITEM_SECOND)).GetValue() != 2)
+                    nFailures++;
+                if (!static_cast<const SfxBoolItem&>(aSource.Get(ITEM_THIRD)).GetValue())
+                    nFailures++;
+                if (static_cast<const SfxUInt16Item*>(pPool->GetPoolDefaultItem(ITEM_FIRST))
+                        ->GetValue()
+                    != 1)
+                    nFailures++;
+                if (pPool->GetWhichIDFromSlotID(10002) != ITEM_SECOND)
+                    nFailures++;
+                if (pPool->GetMergedIdRanges().TotalCount() != 3)
+                    nFailures++;
+            }
+        });
+    }
+
+    for (auto& rThread : aThreads)
+        rThread.join();
+
+    CPPUNIT_ASSERT_EQUAL(0, nFailures.load());
+
+    // reading does not touch the references of the pooled Items
+    CPPUNIT_ASSERT_EQUAL(sal_uInt32(1), aSource.Get(ITEM_FIRST).GetRefCount());
+}
+
+CPPUNIT_TEST_SUITE_REGISTRATION(ItemPoolTest);
+}
+
+CPPUNIT_PLUGIN_IMPLEMENT();
+
+/* vim:set shiftwidth=4 softtabstop=4 expandtab cinoptions=b1,g0,N-s cinkeys+=0=break: */
@@ -26,6 +26,7 @@
 #include <i18nlangtag/lang.h>
 
 #include <math.h>
+#include <cstdio>
 
 #include <o3tl/nonstaticstring.hxx>
 #include <svl/numformat.hxx>
@@ -38,6 +39,8 @@
 
 #include <memory>
 #include <optional>
+#include <vector>
+#include <osl/time.h>
 #include <unicode/timezone.h>
 
 using namespace ::com::sun::star;
@@ -51,6 +54,15 @@ static std::ostream& operator<<(std::ostream& rStrm, const SharedString& string
 }
 }
 
+// Gets at the fast path switch of a single formatter, see SvNFLanguageData
+class PlainDecimalFastPathTest
+{
+public:
+    static void disable(SvNumberFormatter& rFormatter)
+    {
+        rFormatter.m_aCurrentLanguage.bPlainDecimalFastPath = false;
+    }
+};
 
 namespace {
 
@@ -2060,6 +2072,191 @@ CPPUNIT_TEST_FIXTURE(Test, testTdf147265)
     CPPUNIT_ASSERT_EQUAL(nDefault1, nDefault2);
 }
 
+CPPUNIT_TEST_FIXTURE(Test, testPlainDecimalFastPath)
+{
+    SvNumberFormatter aFormatter(m_xContext, LANGUAGE_ENGLISH_US);
+
+    // Plain decimals are handled without the full scanner, the results must
+    // be the same as the full scanner's; everything else still goes there.
+    static const struct
+    {
+        const char* pInput;
+        double fValue;
+    } aInputs[] = {
+        { "123", 123.0 },
+        { "-123.45", -123.45 },
+        { "+7", 7.0 },
+        { "0.5", 0.5 },
+        { "007", 7.0 },
+        { "0.1000000000000000055511151231257827", 0.1 },
+        { "12345678901234567890", 12345678901234567890.0 },
+        { ".5", 0.5 },
+        { "1e5", 100000.0 },
+        { "1,234", 1234.0 },
+    };
+    for (const auto& rInput : aInputs)
+    {
+        sal_uInt32 nIndex = 0;
+        double fNumber = 0;
+        CPPUNIT_ASSERT_MESSAGE(rInput.pInput,
+            aFormatter.IsNumberFormat(OUString::createFromAscii(rInput.pInput), nIndex, fNumber));
+        CPPUNIT_ASSERT_EQUAL_MESSAGE(rInput.pInput, rInput.fValue, fNumber);
+    }
+
+    // -0 stays a negative zero like with the full scanner
+    sal_uInt32 nIndex = 0;
+    double fNumber = 0;
+    CPPUNIT_ASSERT(aFormatter.IsNumberFormat(u"-0"_ustr, nIndex, fNumber));
+    CPPUNIT_ASSERT(std::signbit(fNumber));
+
+    sal_uInt32 nFormat = aFormatter.GetEntryKey(u"0.00", LANGUAGE_ENGLISH_US);
+    CPPUNIT_ASSERT(nFormat != NUMBERFORMAT_ENTRY_NOT_FOUND);
+    static const struct
+    {
+        double fValue;
+        const char* pOutput;
+    } aOutputs[] = {
+        { 0.0, "0.00" },
+        { 0.5, "0.50" },
+        { -0.001, "0.00" },
+        { -1.005, "-1.01" },
+        { 1234567.891, "1234567.89" },
+        { 123456789012345.0, "123456789012345.00" },
+        { 1e20, "100000000000000000000.00" },
+    };
+    OUString aOutput;
+    const Color* pColor;
+    for (const auto& rOutput : aOutputs)
+    {
+        aFormatter.GetOutputString(rOutput.fValue, nFormat, aOutput, &pColor);
+        CPPUNIT_ASSERT_EQUAL(OUString::createFromAscii(rOutput.pOutput), aOutput);
+    }
+    nFormat = aFormatter.GetEntryKey(u"0", LANGUAGE_ENGLISH_US);
+    CPPUNIT_ASSERT(nFormat != NUMBERFORMAT_ENTRY_NOT_FOUND);
+    aFormatter.GetOutputString(-0.4, nFormat, aOutput, &pColor);
+    CPPUNIT_ASSERT_EQUAL(u"0"_ustr, aOutput);
+    aFormatter.GetOutputString(-2.5, nFormat, aOutput, &pColor);
+    CPPUNIT_ASSERT_EQUAL(u"-3"_ustr, aOutput);
+}
+
+CPPUNIT_TEST_FIXTURE(Test, testPlainDecimalThroughput)
+{
+    // Not a correctness test, reports the time the common CSV/ODS import and
+    // display cases take.
+    constexpr sal_Int32 nValues = 1000000;
+    SvNumberFormatter aFormatter(m_xContext, LANGUAGE_ENGLISH_US);
+    std::vector<OUString> aInputs;
+    aInputs.reserve(nValues);
+    for (sal_Int32 i = 0; i < nValues; ++i)
+        aInputs.push_back(OUString::number(i * 37 % 1000003) + "." + OUString::number(i % 100));
+
+    sal_uInt32 nTime = osl_getGlobalTimer();
+    double fSum = 0;
+    for (const OUString& rInput : aInputs)
+    {
+        sal_uInt32 nIndex = 0;
+        double fNumber = 0;
+        CPPUNIT_ASSERT(aFormatter.IsNumberFormat(rInput, nIndex, fNumber));
+        fSum += fNumber;
+    }
+    nTime = osl_getGlobalTimer() - nTime;
+    printf("Parsing %" SAL_PRIdINT32 " decimals took %" SAL_PRIuUINT32 " ms\n", nValues, nTime);
+    CPPUNIT_ASSERT(fSum > 0);
+
+    const sal_uInt32 nFormat = aFormatter.GetEntryKey(u"0.00", LANGUAGE_ENGLISH_US);
+    OUString aOutput;
+    const Color* pColor;
+    nTime = osl_getGlobalTimer();
+    for (sal_Int32 i = 0; i < nValues; ++i)
+        aFormatter.GetOutputString(i * 0.37, nFormat, aOutput, &pColor);
+    nTime = osl_getGlobalTimer() - nTime;
+    printf("Formatting %" SAL_PRIdINT32 " values as 0.00 took %" SAL_PRIuUINT32 " ms\n", nValues, nTime);
+    CPPUNIT_ASSERT(!aOutput.isEmpty());
+}
+
+CPPUNIT_TEST_FIXTURE(Test, testPlainDecimalFastPathOnOff)
+{
+    // Parse and format the same values with the plain decimal fast paths
+    // switched on and off, the general code paths have to agree bit for bit.
+    static const char* const aInputs[] = {
+        "0", "-0", "+0", "1", "-1", "+1", "007", "123", "-123.45", "0.5", "0.05",
+        "1.005", "-2.5", "3.14159265358979", "0.1000000000000000055511151231257827",
+        "4503599627370497", "9007199254740993", "12345678901234567890", "99999999999999.995",
+        "1.", ".5", "1e5", "1,234", "- 1", "1.2.3", "12:30", "1/2", "5%", "$3"
+    };
+    static const double aValues[] = {
+        0.0, -0.0, 0.001, -0.001, 0.005, -0.005, 0.5, -0.5, 1.005, -1.005, 2.5, -2.5,
+        0.125, 1234567.891, -1234567.891, 123456789012345.0, 999999999999999.0, 1e15,
+        1e20, -1e20, 4503599627370496.5, 0.1 + 0.2, 1.0 / 3.0
+    };
+
+    struct Result
+    {
+        std::vector<bool> aIsNumber;
+        std::vector<double> aNumbers;
+        std::vector<sal_uInt32> aIndices;
+        std::vector<OUString> aOutputs;
+    };
+    auto lcl_run = [this](bool bFastPath)
+    {
+        SvNumberFormatter aFormatter(m_xContext, LANGUAGE_ENGLISH_US);
+        if (!bFastPath)
+            PlainDecimalFastPathTest::disable(aFormatter);
+        Result aResult;
+        const sal_uInt32 nPlainKeys[] = {
+            aFormatter.GetEntryKey(u"0", LANGUAGE_ENGLISH_US),
+            aFormatter.GetEntryKey(u"0.00", LANGUAGE_ENGLISH_US)
+        };
+        for (const sal_uInt32 nStartIndex : { sal_uInt32(0), nPlainKeys[0], nPlainKeys[1] })
+        {
+            CPPUNIT_ASSERT(nStartIndex != NUMBERFORMAT_ENTRY_NOT_FOUND);
+            for (const char* pInput : aInputs)
+            {
+                sal_uInt32 nIndex = nStartIndex;
+                double fNumber = 0;
+                aResult.aIsNumber.push_back(aFormatter.IsNumberFormat(
+                    OUString::createFromAscii(pInput), nIndex, fNumber));
+                aResult.aNumbers.push_back(fNumber);
+                aResult.aIndices.push_back(nIndex);
+            }
+        }
+        OUString aOutput;
+        const Color* pColor;
+        for (const sal_uInt32 nKey : nPlainKeys)
+        {
+            for (const double fValue : aValues)
+            {
+                aFormatter.GetOutputString(fValue, nKey, aOutput, &pColor);
+                aResult.aOutputs.push_back(aOutput);
+            }
+        }
+        return aResult;
+    };
+
+    const Result aFast = lcl_run(true);
+    const Result aFull = lcl_run(false);
+
+    const size_t nInputs = std::size(aInputs);
+    CPPUNIT_ASSERT_EQUAL(aFull.aNumbers.size(), aFast.aNumbers.size());
+    for (size_t i = 0; i < aFast.aNumbers.size(); ++i)
+    {
+        const OString aMsg(OString::Concat(aInputs[i % nInputs]) + " with format #"
+                           + OString::number(i / nInputs));
+        CPPUNIT_ASSERT_EQUAL_MESSAGE(aMsg.getStr(), aFull.aIsNumber[i], aFast.aIsNumber[i]);
+        CPPUNIT_ASSERT_EQUAL_MESSAGE(aMsg.getStr(), aFull.aIndices[i], aFast.aIndices[i]);
+        // bit for bit, including the sign of zero
+        CPPUNIT_ASSERT_EQUAL_MESSAGE(aMsg.getStr(), aFull.aNumbers[i], aFast.aNumbers[i]);
+        CPPUNIT_ASSERT_EQUAL_MESSAGE(aMsg.getStr(), std::signbit(aFull.aNumbers[i]),
+                                     std::signbit(aFast.aNumbers[i]));
+    }
+    CPPUNIT_ASSERT_EQUAL(aFull.aOutputs.size(), aFast.aOutputs.size());
+    for (size_t i = 0; i < aFast.aOutputs.size(); ++i)
+    {
+        const OString aMsg(OString::number(aValues[i % std::size(aValues)]));
+        CPPUNIT_ASSERT_EQUAL_MESSAGE(aMsg.getStr(), aFull.aOutputs[i], aFast.aOutputs[i]);
+    }
+}
+
 CPPUNIT_TEST_SUITE_REGISTRATION(Test);
 
 }
@@ -199,9 +199,10 @@ ItemInfoUser::~ItemInfoUser()
 
 const SlotIDToWhichIDMap& ItemInfoPackage::getSlotIDToWhichIDMap() const
 {
-    if (maSlotIDToWhichIDMap.empty())
+    // will be filled only once per office runtime, even when Pools of
+    // the same kind get created concurrently
+    std::call_once(maSlotIDToWhichIDMapOnce, [this]()
     {
-        // will be filled only once per office runtime
         for (size_t a(0); a < size(); a++)
         {
             const ItemInfoStatic& rCandidate(getItemInfoStatic(a));
@@ -214,7 +215,7 @@ const SlotIDToWhichIDMap& ItemInfoPackage::getSlotIDToWhichIDMap() const
                 maSlotIDToWhichIDMap[rCandidate.getSlotID()] = rCandidate.getWhich();
             }
         }
-    }
+    });
 
     return maSlotIDToWhichIDMap;
 }
@@ -261,6 +262,9 @@ void SfxItemPool::registerItemInfoPackage(
     // set mapper for fast SlotIDToWhichID conversion
     mpSlotIDToWhichIDMap = &rPackage.getSlotIDToWhichIDMap();
 
+    // our range is known now, update WhichRanges of the whole chain
+    impUpdateMergedIdRanges();
+
 #ifdef DBG_UTIL
     for (size_t a(1); a < maItemInfos.size(); a++)
         if (maItemInfos[a-1]->getWhich() + 1 != maItemInfos[a]->getWhich())
@@ -358,6 +362,7 @@ void SfxItemPool::cleanupItemInfos()
 
 void SfxItemPool::registerItemSet(SfxItemSet& rSet)
 {
+    std::scoped_lock aGuard(GetMasterPool()->maRegistrationMutex);
     registeredSfxItemSets& rTarget(GetMasterPool()->maRegisteredSfxItemSets);
 #ifdef DBG_UTIL
     const size_t nBefore(rTarget.size());
@@ -374,6 +379,7 @@ void SfxItemPool::registerItemSet(SfxItemSet& rSet)
 
 void SfxItemPool::unregisterItemSet(SfxItemSet& rSet)
 {
+    std::scoped_lock aGuard(GetMasterPool()->maRegistrationMutex);
     registeredSfxItemSets& rTarget(GetMasterPool()->maRegisteredSfxItemSets);
 #ifdef DBG_UTIL
     const size_t nBefore(rTarget.size());
@@ -390,6 +396,7 @@ void SfxItemPool::unregisterItemSet(SfxItemSet& rSet)
 
 void SfxItemPool::registerPoolItemHolder(SfxPoolItemHolder& rHolder)
 {
+    std::scoped_lock aGuard(GetMasterPool()->maRegistrationMutex);
     registeredSfxPoolItemHolders& rTarget(GetMasterPool()->maRegisteredSfxPoolItemHolders);
 #ifdef DBG_UTIL
     const size_t nBefore(rTarget.size());
@@ -408,6 +415,7 @@ void SfxItemPool::registerPoolItemHolder(SfxPoolItemHolder& rHolder)
 
 void SfxItemPool::unregisterPoolItemHolder(SfxPoolItemHolder& rHolder)
 {
+    std::scoped_lock aGuard(GetMasterPool()->maRegistrationMutex);
     registeredSfxPoolItemHolders& rTarget(GetMasterPool()->maRegisteredSfxPoolItemHolders);
 #ifdef DBG_UTIL
     const size_t nBefore(rTarget.size());
@@ -427,6 +435,7 @@ void SfxItemPool::unregisterPoolItemHolder(SfxPoolItemHolder& rHolder)
 void SfxItemPool::registerNameOrIndex(const SfxPoolItem& rItem)
 {
     assert(rItem.isNameOrIndex() && "ITEM: only Items derived from NameOrIndex supported for this mechanism (!)");
+    std::scoped_lock aGuard(GetMasterPool()->maRegistrationMutex);
     NameOrIndexContent& rTarget(GetMasterPool()->maRegisteredNameOrIndex[rItem.ItemType()]);
     NameOrIndexContent::iterator aHit(rTarget.find(&rItem));
     if (aHit == rTarget.end())
@@ -438,6 +447,7 @@ void SfxItemPool::registerNameOrIndex(const SfxPoolItem& rItem)
 void SfxItemPool::unregisterNameOrIndex(const SfxPoolItem& rItem)
 {
     assert(rItem.isNameOrIndex() && "ITEM: only Items derived from NameOrIndex supported for this mechanism (!)");
+    std::scoped_lock aGuard(GetMasterPool()->maRegistrationMutex);
     NameOrIndexContent& rTarget(GetMasterPool()->maRegisteredNameOrIndex[rItem.ItemType()]);
     NameOrIndexContent::iterator aHit(rTarget.find(&rItem));
     assert(aHit != rTarget.end() && "ITEM: malformed order of buffered NameOrIndex Items, entry *expected* (!)");
@@ -556,6 +566,8 @@ SfxItemPool::SfxItemPool(const SfxItemPool& rPool) //  Copy from this instance
     // Repair linkage
     if ( rPool.mpSecondary )
         SetSecondaryPool( rPool.mpSecondary->Clone().get() );
+    else
+        impUpdateMergedIdRanges();
 }
 
 SfxItemPool::~SfxItemPool()
@@ -595,7 +607,13 @@ void SfxItemPool::SetSecondaryPool( SfxItemPool *pPool )
         p->mpMaster = pNewMaster;
 
     // Remember new Secondary Pool
+    rtl::Reference<SfxItemPool> xOldSecondary(mpSecondary);
     mpSecondary = pPool;
+
+    // the detached chain and ours changed, update their WhichRanges
+    if (xOldSecondary.is() && xOldSecondary.get() != pPool)
+        xOldSecondary->impUpdateMergedIdRanges();
+    impUpdateMergedIdRanges();
 }
 
 MapUnit SfxItemPool::GetMetric( sal_uInt16 ) const
@@ -636,7 +654,6 @@ void SfxItemPool::sendShutdownHint()
 
     // Inform e.g. running Requests
     aBC.Broadcast( SfxHint( SfxHintId::Dying ) );
-    maPoolRanges.reset();
 }
 
 void SfxItemPool::SetUserDefaultItem(const SfxPoolItem& rItem)
@@ -743,16 +760,19 @@ SfxItemPool* SfxItemPool::GetLastPoolInChain()
     return pLast;
 }
 
-const WhichRangesContainer& SfxItemPool::GetMergedIdRanges() const
+void SfxItemPool::impUpdateMergedIdRanges()
 {
-    if (maPoolRanges.empty())
+    // Each Pool of the chain covers its own range plus those of all its
+    // secondaries. Done eagerly whenever the chain changes so that
+    // GetMergedIdRanges() stays a pure read that can be used concurrently
+    for (SfxItemPool* pPool = GetMasterPool(); pPool; pPool = pPool->mpSecondary.get())
     {
         // Merge all ranges, keeping them sorted
-        for (const SfxItemPool* pPool = this; pPool; pPool = pPool->mpSecondary.get())
-            maPoolRanges = maPoolRanges.MergeRange(pPool->mnStart, pPool->mnEnd);
+        WhichRangesContainer aRanges;
+        for (const SfxItemPool* pCandidate = pPool; pCandidate; pCandidate = pCandidate->mpSecondary.get())
+            aRanges = aRanges.MergeRange(pCandidate->mnStart, pCandidate->mnEnd);
+        pPool->maPoolRanges = std::move(aRanges);
     }
-
-    return maPoolRanges;
 }
 
 const SfxPoolItem* SfxItemPool::GetPoolDefaultItem(sal_uInt16 nWhich) const
@@ -21,6 +21,7 @@
 #include <string.h>
 
 #include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <cstddef>
 #include <unordered_map>
@@ -1417,9 +1418,7 @@ WhichRangesContainer::WhichRangesContainer( const WhichPair* wids, sal_Int32 nSi
 : m_pairs(nullptr)
 , m_size(nSize)
 , m_TotalCount(0)
-, m_aLastWhichPairOffset(INVALID_WHICHPAIR_OFFSET)
-, m_aLastWhichPairFirst(0)
-, m_aLastWhichPairSecond(0)
+, m_nLastWhichPair(0)
 , m_bOwnRanges(true)
 {
     auto p = new WhichPair[nSize];
@@ -1433,9 +1432,7 @@ WhichRangesContainer::WhichRangesContainer(sal_uInt16 nWhichStart, sal_uInt16 nW
 : m_pairs(nullptr)
 , m_size(1)
 , m_TotalCount(0)
-, m_aLastWhichPairOffset(INVALID_WHICHPAIR_OFFSET)
-, m_aLastWhichPairFirst(0)
-, m_aLastWhichPairSecond(0)
+, m_nLastWhichPair(0)
 , m_bOwnRanges(true)
 {
     auto p = new WhichPair[1];
@@ -1449,9 +1446,9 @@ WhichRangesContainer::WhichRangesContainer(WhichRangesContainer && other)
     std::swap(m_pairs, other.m_pairs);
     std::swap(m_size, other.m_size);
     std::swap(m_TotalCount, other.m_TotalCount);
-    std::swap(m_aLastWhichPairOffset, other.m_aLastWhichPairOffset);
-    std::swap(m_aLastWhichPairFirst, other.m_aLastWhichPairFirst);
-    std::swap(m_aLastWhichPairSecond, other.m_aLastWhichPairSecond);
+    m_nLastWhichPair.store(other.m_nLastWhichPair.exchange(
+        m_nLastWhichPair.load(std::memory_order_relaxed), std::memory_order_relaxed),
+        std::memory_order_relaxed);
     std::swap(m_bOwnRanges, other.m_bOwnRanges);
 }
 
@@ -1460,9 +1457,9 @@ WhichRangesContainer& WhichRangesContainer::operator=(WhichRangesContainer && ot
     std::swap(m_pairs, other.m_pairs);
     std::swap(m_size, other.m_size);
     std::swap(m_TotalCount, other.m_TotalCount);
-    std::swap(m_aLastWhichPairOffset, other.m_aLastWhichPairOffset);
-    std::swap(m_aLastWhichPairFirst, other.m_aLastWhichPairFirst);
-    std::swap(m_aLastWhichPairSecond, other.m_aLastWhichPairSecond);
+    m_nLastWhichPair.store(other.m_nLastWhichPair.exchange(
+        m_nLastWhichPair.load(std::memory_order_relaxed), std::memory_order_relaxed),
+        std::memory_order_relaxed);
     std::swap(m_bOwnRanges, other.m_bOwnRanges);
     return *this;
 }
@@ -1473,9 +1470,8 @@ WhichRangesContainer& WhichRangesContainer::operator=(WhichRangesContainer const
 
     m_size = other.m_size;
     m_TotalCount = other.m_TotalCount;
-    m_aLastWhichPairOffset = other.m_aLastWhichPairOffset;
-    m_aLastWhichPairFirst = other.m_aLastWhichPairFirst;
-    m_aLastWhichPairSecond = other.m_aLastWhichPairSecond;
+    m_nLastWhichPair.store(other.m_nLastWhichPair.load(std::memory_order_relaxed),
+                           std::memory_order_relaxed);
     m_bOwnRanges = other.m_bOwnRanges;
 
     if (m_bOwnRanges)
@@ -1518,22 +1514,24 @@ void WhichRangesContainer::reset()
     m_pairs = nullptr;
     m_size = 0;
     m_TotalCount = 0;
-    m_aLastWhichPairOffset = INVALID_WHICHPAIR_OFFSET;
-    m_aLastWhichPairFirst = 0;
-    m_aLastWhichPairSecond = 0;
+    m_nLastWhichPair.store(0, std::memory_order_relaxed);
 }
 
 #ifdef DBG_UTIL
-static size_t g_nHit(0);
-static size_t g_nMiss(1);
+// doesContainWhich may be called from several threads at once
+static std::atomic<size_t> g_nHit(0);
+static std::atomic<size_t> g_nMiss(1);
 static bool g_bShowWhichRangesHitRate(getenv("SVL_SHOW_WHICHRANGES_HITRATE"));
-static void isHit() { g_nHit++; }
+static void isHit() { g_nHit.fetch_add(1, std::memory_order_relaxed); }
 static void isMiss()
 {
-    g_nMiss++;
-    const double fHitRate(double(g_nHit) /double(g_nMiss));
-    if (0 == g_nMiss % 1000 && g_bShowWhichRangesHitRate)
-        SAL_WARN("svl", "ITEM: hits: " << g_nHit << " misses: " << g_nMiss << " hits/misses(rate): " << fHitRate);
+    const size_t nMiss(g_nMiss.fetch_add(1, std::memory_order_relaxed) + 1);
+    if (0 == nMiss % 1000 && g_bShowWhichRangesHitRate)
+    {
+        const size_t nHit(g_nHit.load(std::memory_order_relaxed));
+        const double fHitRate(double(nHit) /double(nMiss));
+        SAL_WARN("svl", "ITEM: hits: " << nHit << " misses: " << nMiss << " hits/misses(rate): " << fHitRate);
+    }
 }
 #endif
 
@@ -1553,9 +1551,10 @@ bool WhichRangesContainer::doesContainWhich(sal_uInt16 nWhich) const
         return false;
 
     // check if nWhich is inside last successfully used WhichPair
-    if (INVALID_WHICHPAIR_OFFSET != m_aLastWhichPairOffset
-        && m_aLastWhichPairFirst <= nWhich
-        && nWhich <= m_aLastWhichPairSecond)
+    const sal_uInt32 nLast(m_nLastWhichPair.load(std::memory_order_relaxed));
+    if (0 != nLast
+        && (nLast >> 16) <= nWhich
+        && nWhich <= (nLast & 0xffff))
     {
 #ifdef DBG_UTIL
         isHit();
@@ -1569,29 +1568,21 @@ bool WhichRangesContainer::doesContainWhich(sal_uInt16 nWhich) const
 #endif
 
     // we have to find the correct WhichPair, iterate linear. This
-    // also directly updates the buffered m_aLastWhichPair* values
-    m_aLastWhichPairOffset = 0;
-
+    // also directly updates the buffered m_nLastWhichPair value
     for (const WhichPair& rPair : *this)
     {
         // Within this range?
         if( rPair.first <= nWhich && nWhich <= rPair.second )
         {
             // found, remember parameters for buffered hits
-            m_aLastWhichPairFirst = rPair.first;
-            m_aLastWhichPairSecond = rPair.second;
+            m_nLastWhichPair.store(
+                (sal_uInt32(rPair.first) << 16) | rPair.second, std::memory_order_relaxed);
 
             // ...and return
             return true;
         }
-
-        m_aLastWhichPairOffset += rPair.second - rPair.first + 1;
     }
 
-    // *need* to reset: if 1st WhichPair only one entry it could be 1
-    // what could wrongly trigger re-use above for next search
-    m_aLastWhichPairOffset = INVALID_WHICHPAIR_OFFSET;
-
     return false;
 }
 
@@ -1604,9 +1595,6 @@ WhichRangesContainer WhichRangesContainer::MergeRange(sal_uInt16 nFrom,
     if (empty())
         return WhichRangesContainer(nFrom, nTo);
 
-    // reset buffer
-    m_aLastWhichPairOffset = INVALID_WHICHPAIR_OFFSET;
-
     // create vector of ranges (sal_uInt16 pairs of lower and upper bound)
     const size_t nOldCount = size();
     // Allocate one item more than we already have.
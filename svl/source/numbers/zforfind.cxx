@@ -179,6 +179,52 @@ double ImpSvNumberInputScan::StringToDouble( std::u16string_view aStr, bool bFor
     return strtod_nolocale(buf, nullptr);
 }
 
+
+bool ImpSvNumberInputScan::IsPlainDecimal( const OUString& rString, bool bAllowSign,
+                                           double& fOutNumber ) const
+{
+    if (!cPlainDecSep || !mrCurrentLanguageData.IsPlainDecimalFastPath())
+        return false;
+
+    // Callers ensure the length is within the 308 characters limit.
+    char aBuf[320];
+    char* pBuf = aBuf;
+    const sal_Unicode* p = rString.getStr();
+    const sal_Unicode* const pEnd = p + rString.getLength();
+    bool bNegative = false;
+    if (p < pEnd && (*p == '-' || *p == '+'))
+    {
+        if (!bAllowSign)
+            return false;
+        bNegative = (*p == '-');
+        ++p;
+    }
+    const sal_Unicode* const pIntStart = p;
+    while (p < pEnd && rtl::isAsciiDigit(*p))
+        *pBuf++ = static_cast<char>(*p++);
+    if (p == pIntStart)
+        return false;
+    if (p < pEnd)
+    {
+        if (*p != cPlainDecSep)
+            return false;
+        *pBuf++ = '.';
+        const sal_Unicode* const pFracStart = ++p;
+        while (p < pEnd && rtl::isAsciiDigit(*p))
+            *pBuf++ = static_cast<char>(*p++);
+        if (p == pFracStart || p < pEnd)
+            return false;
+    }
+    *pBuf = 0;
+
+    // Same conversion as StringToDouble() so results are identical to the
+    // full scanner's.
+    fOutNumber = strtod_nolocale(aBuf, nullptr);
+    if (bNegative)
+        fOutNumber = -fOutNumber;
+    return true;
+}
+
 namespace {
 
 /**
@@ -3851,6 +3897,29 @@ void ImpSvNumberInputScan::InvalidateDateAcceptancePatterns()
     {
         sDateAcceptancePatterns = css::uno::Sequence< OUString >();
     }
+    // Also called by ChangeIntl(), depends on the patterns.
+    InitPlainDecSep();
+}
+
+
+void ImpSvNumberInputScan::InitPlainDecSep()
+{
+    // Plain decimal input may only bypass the full scanner if the decimal
+    // separator can't be part of a date or time input in this locale.
+    cPlainDecSep = 0;
+    const OUString& rDecSep = mrCurrentLanguageData.GetNumDecimalSep();
+    if (rDecSep.getLength() != 1 || bDecSepInDateSeps)
+        return;
+    const sal_Unicode cDecSep = rDecSep[0];
+    const LocaleDataWrapper* pLoc = mrCurrentLanguageData.GetLocaleData();
+    if (rtl::isAsciiDigit(cDecSep) || pLoc->getTimeSep().indexOf(cDecSep) >= 0)
+        return;
+    for (const OUString& rPattern : pLoc->getDateAcceptancePatterns())
+    {
+        if (rPattern.indexOf(cDecSep) >= 0)
+            return;
+    }
+    cPlainDecSep = cDecSep;
 }
 
 
@@ -3884,6 +3953,19 @@ bool ImpSvNumberInputScan::IsNumberFormat( const OUString& rString,         // s
     {
         res = false;
     }
+    else if ((!pFormat || pFormat->GetMaskedType() == SvNumFormatType::NUMBER) &&
+             IsPlainDecimal( rString, !pFormat, fOutNumber))
+    {
+        // No need to upper-case and split up the input, leave the scanner in
+        // the state a full analysis of a plain number would have.
+        // A sign is only handled for the General format, other formats may
+        // have a negative subformat without '-'.
+        Reset();
+        mpFormat = pFormat;
+        eScannedType = SvNumFormatType::NUMBER;
+        F_Type = eScannedType;
+        return true;
+    }
     else
     {
         // NoMoreUpperNeeded, all comparisons on UpperCase
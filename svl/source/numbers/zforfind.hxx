@@ -99,6 +99,7 @@ private:
     sal_uInt16 nStringsCnt;                          //* Total count of scanned substrings
     sal_uInt16 nNumericsCnt;                         //* Count of numeric substrings
     bool       bDecSepInDateSeps;                    //* True <=> DecSep in {.,-,/,DateSep}
+    sal_Unicode cPlainDecSep;                        //* DecSep usable by IsPlainDecimal(), 0 if none
     sal_uInt8  nMatchedAllStrings;                   //* Scan...String() matched all substrings,
 
     // bit mask of nMatched... constants
@@ -198,6 +199,18 @@ private:
     static double StringToDouble( std::u16string_view aStr,
                                   bool bForceFraction = false );
 
+    /** Fast path for the most common input, an optionally signed plain
+        decimal number like 123 or -123.45 without group separators,
+        exponent, blanks, currency or percent.
+
+        @return false if the input is anything else or the locale's decimal
+                separator is ambiguous, then the full scanner has to decide.
+     */
+    bool IsPlainDecimal( const OUString& rString, bool bAllowSign, double& fOutNumber ) const;
+
+    // Determine cPlainDecSep for the current locale.
+    void InitPlainDecSep();
+
     // Next number/string symbol
     static bool NextNumberStringSymbol( const sal_Unicode*& pStr,
                                         OUString& rSymbol );
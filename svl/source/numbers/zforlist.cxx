@@ -291,6 +291,7 @@ SvNFLanguageData::SvNFLanguageData(const Reference<XComponentContext>& rxContext
     , ActLnge(eLang)
     , aLanguageTag(eLang)
     , eEvalDateFormat(NfEvalDateFormat::International)
+    , bPlainDecimalFastPath(true)
 {
     xCharClass.changeLocale(xContext, aLanguageTag);
     xLocaleData.init(aLanguageTag);
@@ -318,6 +319,7 @@ SvNFLanguageData::SvNFLanguageData(const SvNFLanguageData& rOther)
     , aThousandSep(rOther.aThousandSep)
     , aDateSep(rOther.aDateSep)
     , eEvalDateFormat(rOther.eEvalDateFormat)
+    , bPlainDecimalFastPath(rOther.bPlainDecimalFastPath)
 {
     xCharClass.changeLocale(xContext, aLanguageTag);
     xLocaleData.init(aLanguageTag);
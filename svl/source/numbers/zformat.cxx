@@ -47,6 +47,7 @@
 #include <svl/nfsymbol.hxx>
 
 #include <cmath>
+#include <algorithm>
 #include <array>
 
 using namespace svt;
@@ -354,6 +355,7 @@ void SvNumberformat::ImpCopyNumberformat( const SvNumberformat& rFormat )
     bIsUsed       = rFormat.bIsUsed;
     sComment      = rFormat.sComment;
     bAdditionalBuiltin = rFormat.bAdditionalBuiltin;
+    mnPlainDecimals = rFormat.mnPlainDecimals;
 
     // #121103# when copying between documents, get color pointers from own scanner
     ImpSvNumberformatScan* pColorSc = ( &rScan != &rFormat.rScan ) ? &rScan : nullptr;
@@ -1368,6 +1370,49 @@ SvNumberformat::SvNumberformat(OUString& rString,
         eOp1 = NUMBERFORMAT_OP_GE; // Add 0 to the first format
     }
 
+    ImpInitPlainDecimals();
+}
+
+void SvNumberformat::ImpInitPlainDecimals()
+{
+    mnPlainDecimals = -1;
+    if (eType != SvNumFormatType::NUMBER || eOp1 != NUMBERFORMAT_OP_NO ||
+        NumFor[1].GetCount() || NumFor[2].GetCount() || NumFor[3].GetCount())
+    {
+        return;
+    }
+    const ImpSvNumFor& rNumFor = NumFor[0];
+    const ImpSvNumberformatInfo& rInfo = rNumFor.Info();
+    const sal_uInt16 nCnt = rNumFor.GetCount();
+    if (nCnt == 0 || rNumFor.GetColor() || rNumFor.GetNatNum().IsSet() ||
+        rInfo.eScannedType != SvNumFormatType::NUMBER || rInfo.bThousand ||
+        rInfo.nThousand != 0 || rInfo.nCntPre != 1 ||
+        rInfo.nTypeArray[0] != NF_SYMBOLTYPE_DIGIT || rInfo.sStrArray[0] != "0")
+    {
+        return;
+    }
+    sal_Int32 nDecimals = 0;
+    for (sal_uInt16 i = 1; i < nCnt; ++i)
+    {
+        if (i == 1)
+        {
+            if (rInfo.nTypeArray[i] != NF_SYMBOLTYPE_DECSEP)
+                return;
+        }
+        else if (rInfo.nTypeArray[i] == NF_SYMBOLTYPE_DIGIT &&
+                 std::all_of(rInfo.sStrArray[i].getStr(),
+                             rInfo.sStrArray[i].getStr() + rInfo.sStrArray[i].getLength(),
+                             [](sal_Unicode c) { return c == '0'; }))
+        {
+            nDecimals += rInfo.sStrArray[i].getLength();
+        }
+        else
+            return;
+    }
+    // A trailing decimal separator without decimals is displayed, not handled here.
+    if ((nCnt > 1 && nDecimals == 0) || nDecimals != rInfo.nCntPost)
+        return;
+    mnPlainDecimals = static_cast<sal_Int16>(nDecimals);
 }
 
 SvNumberformat::~SvNumberformat()
@@ -2582,9 +2627,8 @@ bool SvNumberformat::GetOutputString(double fNumber,
                 }
                 return false;
             }
-            ImpGetOutputStandard(fNumber, sBuff, rNatNum);
-            bHadStandard = true;
-            break;
+            ImpGetOutputStandard(fNumber, OutString, rNatNum);
+            return false;
         case SvNumFormatType::DATE:
             bRes |= ImpGetDateOutput(fNumber, 0, bStarFlag, rNatNum, rCurrentLang, sBuff);
             bHadStandard = true;
@@ -2602,6 +2646,11 @@ bool SvNumberformat::GetOutputString(double fNumber,
     }
     if ( !bHadStandard )
     {
+        if (mnPlainDecimals >= 0 && rCurrentLang.IsPlainDecimalFastPath() &&
+                ImpGetPlainDecimalOutput(fNumber, OutString))
+        {
+            return false;
+        }
         sal_uInt16 nIx = GetSubformatIndex ( fNumber ); // Index of the partial format
         if (fNumber < 0.0 &&
                 ((nIx == 0 && IsFirstSubformatRealNegative()) || // 1st, usually positive subformat
@@ -4394,6 +4443,38 @@ bool SvNumberformat::ImpGetLogicalOutput(double fNumber,
     return bRes;
 }
 
+bool SvNumberformat::ImpGetPlainDecimalOutput(double fNumber, OUString& rOutString) const
+{
+    // Produces the same as ImpGetNumberOutput() would for the single
+    // subformat 0 or 0.00... but without walking the symbols, as long as
+    // that doesn't need to pad beyond 15 significant digits.
+    double fAbs = std::fabs(fNumber);
+    if (!(fAbs < 1e15))
+        return false;
+    const sal_uInt16 nDecimals = mnPlainDecimals;
+    sal_Unicode cDecSep = '.';
+    if (nDecimals)
+    {
+        const OUString& rDecSep = NumFor[0].Info().sStrArray[1];
+        if (rDecSep.getLength() != 1)
+            return false;
+        cDecSep = rDecSep[0];
+        if (fAbs > 0.0)
+        {
+            const tools::Long nPrecExp = GetPrecExp(fAbs);
+            if (nDecimals + nPrecExp > 15 && nPrecExp < 15)
+                return false;
+        }
+    }
+    // Make sure that Calc's ROUND and formatted output agree
+    fAbs = rtl_math_round(fAbs, nDecimals, rtl_math_RoundingMode_Corrected);
+
+    rOutString = ::rtl::math::doubleToUString(fAbs, rtl_math_StringFormat_F, nDecimals, cDecSep);
+    if (fNumber < 0.0 && fAbs != 0.0) // Not -0.00
+        rOutString = "-" + rOutString;
+    return true;
+}
+
 bool SvNumberformat::ImpGetNumberOutput(double fNumber,
                                         sal_uInt16 nIx,
                                         bool bStarFlag,
@@ -199,6 +199,30 @@ CPPUNIT_TEST_FIXTURE(TxtImportTest, testTdf70423)
     CPPUNIT_ASSERT_EQUAL(aResStr, aPara);
 }
 
+CPPUNIT_TEST_FIXTURE(TxtImportTest, testMultiBlockParagraphs)
+{
+    createSwDoc();
+
+    SwWrtShell* pWrtShell = getSwDocShell()->GetWrtShell();
+
+    // well over the size of several read blocks of the parser, so that line ends
+    // fall on block boundaries
+    constexpr int nParagraphs = 8000;
+    for (int i = 0; i < nParagraphs; i++)
+    {
+        if (i)
+            pWrtShell->SplitNode();
+        pWrtShell->Insert("paragraph " + OUString::number(i));
+    }
+
+    saveAndReload(u"Text"_ustr);
+
+    CPPUNIT_ASSERT_EQUAL(nParagraphs, getParagraphs());
+    CPPUNIT_ASSERT_EQUAL(u"paragraph 0"_ustr, getParagraph(1)->getString());
+    CPPUNIT_ASSERT_EQUAL(u"paragraph 4321"_ustr, getParagraph(4322)->getString());
+    CPPUNIT_ASSERT_EQUAL(u"paragraph 7999"_ustr, getParagraph(nParagraphs)->getString());
+}
+
 } // end of anonymous namespace
 CPPUNIT_PLUGIN_IMPLEMENT();
 
@@ -44,7 +44,11 @@
 #include <vcl/metric.hxx>
 #include <osl/diagnose.h>
 
+// size of the sample used for encoding detection
 #define ASC_BUFFLEN 4096
+// size of the blocks read and converted at once; large files would otherwise
+// go through many tiny read/convert/progress rounds
+#define ASC_READLEN 65536
 
 namespace {
 
@@ -114,7 +118,7 @@ SwASCIIParser::SwASCIIParser(SwDoc& rD, const SwPaM& rCursor, SvStream& rIn, boo
     , m_bNewDoc(bReadNewDoc)
 {
     m_oPam.emplace(*rCursor.GetPoint());
-    m_pArr.reset(new char[ASC_BUFFLEN + 2]);
+    m_pArr.reset(new char[ASC_READLEN + 2]);
 
     m_oItemSet.emplace(
         m_rDoc.GetAttrPool(),
@@ -317,6 +321,8 @@ ErrCode SwASCIIParser::ReadChars()
     }
 
     std::unique_ptr<sal_Unicode[]> aWork;
+    if (hConverter)
+        aWork.reset(new sal_Unicode[ASC_READLEN + 1]); // add 1 for '\0'
     sal_Size nArrOffset = 0;
 
     do {
@@ -330,7 +336,7 @@ ErrCode SwASCIIParser::ReadChars()
             if (ERRCODE_NONE != m_rInput.GetError()
                 || 0
                        == (lGCount = m_rInput.ReadBytes(m_pArr.get() + nArrOffset,
-                                                        ASC_BUFFLEN - nArrOffset)))
+                                                        ASC_READLEN - nArrOffset)))
                 break;      // break from the while loop
 
             /*
@@ -345,7 +351,6 @@ ErrCode SwASCIIParser::ReadChars()
             {
                 sal_uInt32 nInfo;
                 sal_Size nNewLen = lGCount, nCntBytes;
-                aWork.reset(new sal_Unicode[nNewLen + 1]); // add 1 for '\0'
                 sal_Unicode* pBuf = aWork.get();
                 pBuf[nNewLen] = 0;                         // ensure '\0'
 
@@ -597,6 +597,8 @@ private:
         == 5      : 18515 pap, 47 chp
     */
     std::deque<std::unique_ptr<WW8Fkp>> maFkpCache;
+    /// Lookup of maFkpCache by file position, a linear search got quadratic for large documents.
+    std::unordered_map<tools::Long, WW8Fkp*> maFkpCacheIndex;
     enum Limits {eMaxCache = 50000};
 
     bool NewFkp();
@@ -30,6 +30,7 @@ namespace
         void test_readline();
         void test_makereadonly();
         void test_write_unicode();
+        void test_read_numbers();
 
         CPPUNIT_TEST_SUITE(Test);
         CPPUNIT_TEST(test_stdstream);
@@ -39,6 +40,7 @@ namespace
         CPPUNIT_TEST(test_readline);
         CPPUNIT_TEST(test_makereadonly);
         CPPUNIT_TEST(test_write_unicode);
+        CPPUNIT_TEST(test_read_numbers);
         CPPUNIT_TEST_SUITE_END();
     };
 
@@ -348,6 +350,28 @@ namespace
         }
     }
 
+    void Test::test_read_numbers()
+    {
+        const sal_uInt8 aData[] = { 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09 };
+        SvMemoryStream aMemStream(const_cast<sal_uInt8*>(aData), std::size(aData), StreamMode::READ);
+
+        aMemStream.SetEndian(SvStreamEndian::LITTLE);
+        sal_uInt16 aShorts[4] = {};
+        CPPUNIT_ASSERT_EQUAL(std::size_t(4), aMemStream.ReadNumbers(aShorts, 4));
+        CPPUNIT_ASSERT_EQUAL(sal_uInt16(0x0201), aShorts[0]);
+        CPPUNIT_ASSERT_EQUAL(sal_uInt16(0x0807), aShorts[3]);
+        CPPUNIT_ASSERT(aMemStream.good());
+
+        aMemStream.Seek(0);
+        aMemStream.SetEndian(SvStreamEndian::BIG);
+        sal_Int32 aLongs[3] = {};
+        // only two complete values are available
+        CPPUNIT_ASSERT_EQUAL(std::size_t(2), aMemStream.ReadNumbers(aLongs, 3));
+        CPPUNIT_ASSERT_EQUAL(sal_Int32(0x01020304), aLongs[0]);
+        CPPUNIT_ASSERT_EQUAL(sal_Int32(0x05060708), aLongs[1]);
+        CPPUNIT_ASSERT(aMemStream.eof());
+    }
+
     CPPUNIT_TEST_SUITE_REGISTRATION(Test);
 }
 
@@ -23,6 +23,7 @@
 
 #include <cassert>
 #include <cstddef>
+#include <limits>
 #include <memory>
 
 #include <string.h>
@@ -122,8 +123,7 @@ void SvStream::readNumberWithoutSwap_(void * pDataDest, int nDataSize)
 {
     if (m_isIoRead && nDataSize <= m_nBufFree)
     {
-        for (int i = 0; i < nDataSize; i++)
-            static_cast<char*>(pDataDest)[i] = m_pBufPos[i];
+        memcpy(pDataDest, m_pBufPos, nDataSize);
         m_nBufActualPos += nDataSize;
         m_pBufPos += nDataSize;
         m_nBufFree -= nDataSize;
@@ -777,6 +777,26 @@ template <typename T> SvStream& SvStream::ReadNumber(T& r)
     return *this;
 }
 
+template <typename T> std::size_t SvStream::ReadNumberArray(T* pData, std::size_t nCount)
+{
+    if (!nCount) // pData may be the data() of an empty vector
+        return 0;
+    if (nCount > std::numeric_limits<std::size_t>::max() / sizeof(T))
+        nCount = std::numeric_limits<std::size_t>::max() / sizeof(T);
+    const std::size_t nRead = ReadBytes(pData, nCount * sizeof(T)) / sizeof(T);
+    if (m_isSwap)
+    {
+        for (std::size_t i = 0; i < nRead; ++i)
+            SwapNumber(pData[i]);
+    }
+    return nRead;
+}
+
+std::size_t SvStream::ReadNumbers(sal_Int16* p, std::size_t n) { return ReadNumberArray(p, n); }
+std::size_t SvStream::ReadNumbers(sal_uInt16* p, std::size_t n) { return ReadNumberArray(p, n); }
+std::size_t SvStream::ReadNumbers(sal_Int32* p, std::size_t n) { return ReadNumberArray(p, n); }
+std::size_t SvStream::ReadNumbers(sal_uInt32* p, std::size_t n) { return ReadNumberArray(p, n); }
+
 SvStream& SvStream::ReadUInt16(sal_uInt16& r) { return ReadNumber(r); }
 SvStream& SvStream::ReadUInt32(sal_uInt32& r) { return ReadNumber(r); }
 SvStream& SvStream::ReadUInt64(sal_uInt64& r) { return ReadNumber(r); }
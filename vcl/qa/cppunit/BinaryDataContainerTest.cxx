@@ -20,9 +20,11 @@ namespace
 class BinaryDataContainerTest : public CppUnit::TestFixture
 {
     void testConstruct();
+    void testSharedContent();
 
     CPPUNIT_TEST_SUITE(BinaryDataContainerTest);
     CPPUNIT_TEST(testConstruct);
+    CPPUNIT_TEST(testSharedContent);
     CPPUNIT_TEST_SUITE_END();
 };
 
@@ -60,6 +62,28 @@ void BinaryDataContainerTest::testConstruct()
     }
 }
 
+void BinaryDataContainerTest::testSharedContent()
+{
+    std::vector<sal_uInt8> aBytes(4096);
+    for (size_t i = 0; i < aBytes.size(); ++i)
+        aBytes[i] = static_cast<sal_uInt8>(i * 7);
+
+    SvMemoryStream aStream1(aBytes.data(), aBytes.size(), StreamMode::READ);
+    BinaryDataContainer aContainer1(aStream1, aBytes.size());
+    SvMemoryStream aStream2(aBytes.data(), aBytes.size(), StreamMode::READ);
+    BinaryDataContainer aContainer2(aStream2, aBytes.size());
+
+    // Identical content read independently is held in memory only once
+    CPPUNIT_ASSERT_EQUAL(aContainer1.getData(), aContainer2.getData());
+
+    aBytes[100]++;
+    SvMemoryStream aStream3(aBytes.data(), aBytes.size(), StreamMode::READ);
+    BinaryDataContainer aContainer3(aStream3, aBytes.size());
+    CPPUNIT_ASSERT(aContainer1.getData() != aContainer3.getData());
+    CPPUNIT_ASSERT_EQUAL(sal_uInt8(100 * 7 + 1), aContainer3.getData()[100]);
+    CPPUNIT_ASSERT_EQUAL(sal_uInt8(100 * 7), aContainer1.getData()[100]);
+}
+
 } // namespace
 
 CPPUNIT_TEST_SUITE_REGISTRATION(BinaryDataContainerTest);
@@ -135,6 +135,7 @@ GDIMetaFile::GDIMetaFile( const GDIMetaFile& rMtf ) :
     m_bUseCanvas      ( rMtf.m_bUseCanvas ),
     m_bSVG            ( rMtf.m_bSVG )
 {
+    m_aList.reserve( rMtf.GetActionSize() );
     for( size_t i = 0, n = rMtf.GetActionSize(); i < n; ++i )
     {
         m_aList.push_back( rMtf.GetAction( i ) );
@@ -216,6 +217,7 @@ GDIMetaFile& GDIMetaFile::operator=( const GDIMetaFile& rMtf )
         Clear();
 
         // Increment RefCount of MetaActions
+        m_aList.reserve( rMtf.GetActionSize() );
         for( size_t i = 0, n = rMtf.GetActionSize(); i < n; ++i )
         {
             m_aList.push_back( rMtf.GetAction( i ) );
@@ -1841,6 +1841,15 @@ MetaCommentAction::MetaCommentAction( OString aComment, sal_Int32 nValue, const
     ImplInitDynamicData( pData, nDataSize );
 }
 
+MetaCommentAction::MetaCommentAction( OString aComment, sal_Int32 nValue, std::unique_ptr<sal_uInt8[]> pData, sal_uInt32 nDataSize ) :
+    MetaAction  ( MetaActionType::COMMENT ),
+    maComment   (std::move( aComment )),
+    mnValue     ( nValue ),
+    mnDataSize  ( pData ? nDataSize : 0 ),
+    mpData      ( mnDataSize ? std::move( pData ) : nullptr )
+{
+}
+
 MetaCommentAction::~MetaCommentAction()
 {
 }
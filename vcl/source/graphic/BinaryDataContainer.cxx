@@ -16,8 +16,67 @@
 #include <comphelper/hash.hxx>
 #include <sal/log.hxx>
 
+#include <algorithm>
+#include <cstring>
+#include <mutex>
+#include <string_view>
+#include <unordered_map>
 #include <vector>
 
+namespace
+{
+/*
+ * Process-wide index of the binary data by content, so that the same image
+ * loaded by several documents (templates, mail merge results, ...) is kept
+ * in memory only once. The data is immutable once read, so containers can
+ * simply share the vector; entries only hold weak references.
+ */
+class BinaryDataRegistry
+{
+    // don't bother with tiny data, hashing and lookup would cost more than it saves
+    static constexpr size_t MIN_SIZE = 1024;
+
+    std::mutex maMutex;
+    std::unordered_multimap<size_t, std::weak_ptr<std::vector<sal_uInt8>>> maEntries;
+    size_t mnSweepAt = 64;
+
+public:
+    std::shared_ptr<std::vector<sal_uInt8>> share(std::shared_ptr<std::vector<sal_uInt8>> pData)
+    {
+        if (pData->size() < MIN_SIZE)
+            return pData;
+
+        const size_t nHash = std::hash<std::string_view>()(
+            std::string_view(reinterpret_cast<const char*>(pData->data()), pData->size()));
+
+        std::scoped_lock aGuard(maMutex);
+        auto [itBegin, itEnd] = maEntries.equal_range(nHash);
+        for (auto it = itBegin; it != itEnd; ++it)
+        {
+            std::shared_ptr<std::vector<sal_uInt8>> pExisting = it->second.lock();
+            if (pExisting && pExisting->size() == pData->size()
+                && std::memcmp(pExisting->data(), pData->data(), pData->size()) == 0)
+                return pExisting;
+        }
+
+        // drop entries of data that is gone, amortized over the insertions
+        if (maEntries.size() >= mnSweepAt)
+        {
+            std::erase_if(maEntries, [](const auto& rEntry) { return rEntry.second.expired(); });
+            mnSweepAt = std::max<size_t>(64, 2 * maEntries.size());
+        }
+        maEntries.emplace(nHash, pData);
+        return pData;
+    }
+};
+
+BinaryDataRegistry& getBinaryDataRegistry()
+{
+    static BinaryDataRegistry aRegistry;
+    return aRegistry;
+}
+}
+
 struct BinaryDataContainer::Impl
 {
     // temp file to store the data out of RAM if necessary
@@ -32,7 +91,7 @@ struct BinaryDataContainer::Impl
     {
         auto pData = std::make_shared<std::vector<sal_uInt8>>(size);
         if (stream.ReadBytes(pData->data(), pData->size()) == size)
-            mpData = std::move(pData);
+            mpData = getBinaryDataRegistry().share(std::move(pData));
     }
 
     /// ensure the data is in-RAM
@@ -62,6 +121,11 @@ struct BinaryDataContainer::Impl
         if (!mpData || mpData->empty())
             return;
 
+        // data shared with other containers stays in RAM anyway, writing it
+        // out would only cost a temp file without freeing anything
+        if (mpData.use_count() > 1)
+            return;
+
         mpFile.reset(new utl::TempFileFast());
         auto pStream = mpFile->GetStream(StreamMode::READWRITE);
 
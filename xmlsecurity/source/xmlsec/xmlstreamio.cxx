@@ -19,6 +19,8 @@
 
 #include <sal/config.h>
 
+#include <algorithm>
+
 #include <xmlsec/io.h>
 
 /*
@@ -38,6 +40,12 @@ static bool g_bInputCallbacksRegistered = false;
 
 static css::uno::Reference< css::xml::crypto::XUriBinding > m_xUriBinding ;
 
+// xmlsec asks xmlStreamMatch() and then xmlStreamOpen() for the same uri. Opening a
+// package stream clones it, which copies the whole element, so keep the stream found
+// while matching and hand it out on the following open instead of cloning it again.
+static OString g_aMatchedUri;
+static css::uno::Reference< css::io::XInputStream > g_xMatchedStream;
+
 extern "C" {
 
 static int xmlStreamMatch( const char* uri )
@@ -68,7 +76,11 @@ static int xmlStreamMatch( const char* uri )
     SAL_INFO("xmlsecurity.xmlsec",
              "xmlStreamMath: uri is '" << uri << "', returning " << xInputStream.is());
     if (xInputStream.is())
+    {
+        g_aMatchedUri = uri;
+        g_xMatchedStream = std::move(xInputStream);
         return 1;
+    }
     else
         return 0 ;
 }
@@ -82,17 +94,25 @@ static void* xmlStreamOpen( const char* uri )
         if( uri == nullptr || !m_xUriBinding.is() )
             return nullptr ;
 
-        //see xmlStreamMatch
-        OUString sUri =
-            ::rtl::Uri::encode( OUString::createFromAscii( uri ),
-            rtl_UriCharClassUric, rtl_UriEncodeKeepEscapes, RTL_TEXTENCODING_UTF8);
-        xInputStream = m_xUriBinding->getUriBinding( sUri ) ;
-        if (!xInputStream.is())
+        if (g_xMatchedStream.is() && g_aMatchedUri == uri)
         {
-            //For old documents.
-            //try the passed in uri directly.
-            xInputStream = m_xUriBinding->getUriBinding(
-                OUString::createFromAscii(uri));
+            xInputStream = std::move(g_xMatchedStream);
+            g_aMatchedUri.clear();
+        }
+        else
+        {
+            //see xmlStreamMatch
+            OUString sUri =
+                ::rtl::Uri::encode( OUString::createFromAscii( uri ),
+                rtl_UriCharClassUric, rtl_UriEncodeKeepEscapes, RTL_TEXTENCODING_UTF8);
+            xInputStream = m_xUriBinding->getUriBinding( sUri ) ;
+            if (!xInputStream.is())
+            {
+                //For old documents.
+                //try the passed in uri directly.
+                xInputStream = m_xUriBinding->getUriBinding(
+                    OUString::createFromAscii(uri));
+            }
         }
 
         if( xInputStream.is() ) {
@@ -123,9 +143,7 @@ static int xmlStreamRead( void* context, char* buffer, int len )
                 return 0 ;
 
             numbers = xInputStream->readBytes( outSeqs, len ) ;
-            const sal_Int8* readBytes = outSeqs.getArray() ;
-            for( int i = 0 ; i < numbers ; i ++ )
-                *( buffer + i ) = *( readBytes + i ) ;
+            std::copy_n(outSeqs.getConstArray(), numbers, buffer);
         }
     }
 
@@ -236,6 +254,8 @@ int xmlUnregisterStreamInputCallbacks()
     {
         //Clear the uri-stream binding
         m_xUriBinding.clear() ;
+        g_xMatchedStream.clear();
+        g_aMatchedUri.clear();
 
         //disable the registered flag
         g_bInputCallbacksRegistered = false;